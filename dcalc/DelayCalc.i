@@ -88,6 +88,18 @@ find_delays()
   Sta::sta()->findDelays();
 }
 
+void
+write_checkpoint_cmd(std::string filename)
+{
+  Sta::sta()->writeCheckpoint(filename);
+}
+
+void
+read_checkpoint_cmd(std::string filename)
+{
+  Sta::sta()->readCheckpoint(filename);
+}
+
 void
 delays_invalid()
 {
@@ -447,5 +447,29 @@ proc report_slews { args } {
   }
 }
 
+################################################################
+
+define_cmd_args "write_checkpoint" {filename} \
+  -help {Write the delay calculation arc delays, slews and delay annotations to a binary checkpoint file. The checkpoint can be read with `read_checkpoint` after reading the same design, liberty, parasitics and SDC to skip delay calculation.} \
+  -arg_help {
+    filename {The checkpoint filename to write.}
+  }
+
+proc write_checkpoint { args } {
+  check_argc_eq1 "write_checkpoint" $args
+  write_checkpoint_cmd [file nativename [lindex $args 0]]
+}
+
+define_cmd_args "read_checkpoint" {filename} \
+  -help {Restore the delay calculation arc delays, slews and delay annotations from a checkpoint written by `write_checkpoint`. The design, liberty, parasitics, SDC and scenes must be the same as when the checkpoint was written. A checkpoint written with different liberty or parasitics files or constraints is rejected. Arrival and required times are found by the next timing report. Incremental changes after `read_checkpoint` update the restored delays.} \
+  -arg_help {
+    filename {The checkpoint filename to read.}
+  }
+
+proc read_checkpoint { args } {
+  check_argc_eq1 "read_checkpoint" $args
+  read_checkpoint_cmd [file nativename [lindex $args 0]]
+}
+
 # sta namespace end
 }
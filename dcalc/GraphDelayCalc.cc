@@ -39,11 +39,11 @@
 #include "Liberty.hh"
 #include "MinMax.hh"
 #include "Mode.hh"
-#include "Mutex.hh"
 #include "NetCaps.hh"
 #include "Network.hh"
 #include "Parasitics.hh"
 #include "PortDirection.hh"
+#include "Profiler.hh"
 #include "Sdc.hh"
 #include "Scene.hh"
 #include "SearchPred.hh"
@@ -223,6 +223,18 @@ GraphDelayCalc::delaysInvalid()
   invalid_latch_edges_.clear();
 }
 
+void
+GraphDelayCalc::delaysRestored()
+{
+  debugPrint(debug_, "delay_calc", 1, "delays restored");
+  iter_->clear();
+  invalid_delays_.clear();
+  invalid_check_edges_.clear();
+  invalid_latch_edges_.clear();
+  delays_seeded_ = true;
+  delays_exist_ = true;
+}
+
 void
 GraphDelayCalc::delayInvalid(const Pin *pin)
 {
@@ -341,6 +353,7 @@ void
 GraphDelayCalc::findDelays(Level level)
 {
   Stats stats(debug_, report_);
+  ProfileScope profile("find delays");
   int dcalc_count = 0;
   debugPrint(debug_, "delay_calc", 1, "find delays to level {}", level);
   if (!delays_seeded_) {
@@ -765,7 +778,7 @@ GraphDelayCalc::enqueueCheckEdges(Vertex *vertex)
 {
   if (vertex->hasChecks()) {
     VertexInEdgeIterator edge_iter(vertex, graph_);
-    LockGuard lock(invalid_edge_lock_);
+    ProfileLockGuard lock(invalid_edge_lock_, "dcalc invalid edge");
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
       if (edge->role()->isTimingCheck())
@@ -774,7 +787,7 @@ GraphDelayCalc::enqueueCheckEdges(Vertex *vertex)
   }
   if (vertex->isCheckClk()) {
     VertexOutEdgeIterator edge_iter(vertex, graph_);
-    LockGuard lock(invalid_edge_lock_);
+    ProfileLockGuard lock(invalid_edge_lock_, "dcalc invalid edge");
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
       if (edge->role()->isTimingCheck())
@@ -785,7 +798,7 @@ GraphDelayCalc::enqueueCheckEdges(Vertex *vertex)
     // Latch D->Q arcs have to be re-evaled if level(D) > level(E)
     // because levelization does not traverse D->Q arcs to break loops.
     VertexOutEdgeIterator edge_iter(vertex, graph_);
-    LockGuard lock(invalid_edge_lock_);
+    ProfileLockGuard lock(invalid_edge_lock_, "dcalc invalid edge");
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
       if (edge->role() == TimingRole::latchDtoQ())
@@ -817,7 +830,7 @@ GraphDelayCalc::findMultiDrvrNet(Vertex *drvr_vertex)
 {
   // Avoid locking for single driver nets.
   if (hasMultiDrvrs(drvr_vertex)) {
-    LockGuard lock(multi_drvr_lock_);
+    ProfileLockGuard lock(multi_drvr_lock_, "dcalc multi driver");
     MultiDrvrNet *multi_drvr = multiDrvrNet(drvr_vertex);
     if (multi_drvr)
       return multi_drvr;
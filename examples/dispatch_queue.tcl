@@ -0,0 +1,31 @@
+# Thread dispatch benchmark for short per endpoint and per register
+# tasks. Compare the times with a build using the previous dispatch
+# queue. No reference times are recorded. Run with
+#  sta -exit dispatch_queue.tcl [pass_count]
+read_liberty sky130hd_tt.lib.gz
+read_verilog gcd_sky130hd.v
+link_design gcd
+
+read_sdc gcd_sky130hd.sdc
+set_propagated_clock clk
+read_spef gcd_sky130hd.spef
+report_checks > /dev/null
+
+set pass_count [expr { $argc > 0 ? [lindex $argv 0] : 100 }]
+foreach thread_count [list 1 [sta::processor_count]] {
+  sta::set_thread_count $thread_count
+  set usecs [lindex [time {
+    for {set i 0} {$i < $pass_count} {incr i} {
+      report_checks -group_path_count 1000 -format end > /dev/null
+    }
+  }] 0]
+  puts [format "%d threads report_checks %.3f seconds" \
+          $thread_count [expr $usecs * 1e-6]]
+  set usecs [lindex [time {
+    for {set i 0} {$i < $pass_count} {incr i} {
+      report_clock_skew > /dev/null
+    }
+  }] 0]
+  puts [format "%d threads report_clock_skew %.3f seconds" \
+          $thread_count [expr $usecs * 1e-6]]
+}
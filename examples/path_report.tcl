@@ -0,0 +1,23 @@
+# Compare the size and runtime of json and binary path reports for
+# gcd and convert the binary report to json. Run with
+#  sta -exit path_report.tcl
+read_liberty sky130hd_tt.lib.gz
+read_verilog gcd_sky130hd.v
+link_design gcd
+read_sdc gcd_sky130hd.sdc
+read_spef gcd_sky130hd.spef
+report_checks > /dev/null
+
+set path_args {-group_path_count 1000 -endpoint_path_count 10}
+set usecs [lindex [time {
+  report_checks {*}$path_args -format json > gcd_paths.json
+}] 0]
+puts "json [format %.1f [expr { $usecs / 1000.0 }]]ms [file size gcd_paths.json] bytes"
+
+set usecs [lindex [time {
+  write_path_report {*}$path_args gcd_paths.bin
+}] 0]
+puts "binary [format %.1f [expr { $usecs / 1000.0 }]]ms [file size gcd_paths.bin] bytes"
+
+write_path_report_json gcd_paths.bin gcd_paths_bin.json
+puts "wrote gcd_paths_bin.json [file size gcd_paths_bin.json] bytes"
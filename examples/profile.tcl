@@ -0,0 +1,15 @@
+# Profile timing gcd with all processors and write a Chrome trace
+# to view in Perfetto or chrome://tracing. Run with
+#  sta -exit profile.tcl
+read_liberty sky130hd_tt.lib.gz
+read_verilog gcd_sky130hd.v
+link_design gcd
+read_sdc gcd_sky130hd.sdc
+read_spef gcd_sky130hd.spef
+sta::set_thread_count [sta::processor_count]
+
+start_profile
+report_checks -group_path_count 100 > /dev/null
+stop_profile
+write_profile gcd_profile.json
+puts "wrote gcd_profile.json [file size gcd_profile.json] bytes"
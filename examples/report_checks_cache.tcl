@@ -0,0 +1,29 @@
+# Repeated report_checks -from/-through benchmark for the report checks
+# cache. Each pass reports paths from every input port. Run with
+#  sta -exit report_checks_cache.tcl [pass_count]
+read_liberty sky130hd_tt.lib.gz
+read_verilog gcd_sky130hd.v
+link_design gcd
+read_sdc gcd_sky130hd.sdc
+read_spef gcd_sky130hd.spef
+
+set pass_count [expr { $argc > 0 ? [lindex $argv 0] : 5 }]
+set queries {}
+foreach input [get_ports -filter "direction == input"] {
+  lappend queries [list -from [get_full_name $input] -format full_clock]
+}
+report_checks > /dev/null
+
+foreach cache_size [list 0 [llength $queries]] {
+  set sta_report_checks_cache_size $cache_size
+  set usecs [lindex [time {
+    for {set i 0} {$i < $pass_count} {incr i} {
+      foreach query $queries {
+        report_checks {*}$query > /dev/null
+      }
+    }
+  }] 0]
+  puts [format "cache size %d %d reports %.3f seconds" \
+          $cache_size [expr $pass_count * [llength $queries]] \
+          [expr $usecs * 1e-6]]
+}
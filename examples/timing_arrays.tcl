@@ -0,0 +1,26 @@
+# Compare per pin slack queries against bulk timing arrays for all
+# endpoints of gcd. Run with
+#  sta -exit timing_arrays.tcl
+read_liberty sky130hd_tt.lib.gz
+read_verilog gcd_sky130hd.v
+link_design gcd
+read_sdc gcd_sky130hd.sdc
+read_spef gcd_sky130hd.spef
+sta::set_thread_count [sta::processor_count]
+report_checks > /dev/null
+
+set pins [sta::endpoints]
+set usecs [lindex [time {
+  foreach pin $pins {
+    get_property $pin slack_max
+  }
+}] 0]
+puts "per pin slack [format %.1f [expr { $usecs / 1000.0 }]]ms"
+
+set usecs [lindex [time {
+  lassign [get_timing_arrays -all_endpoints] slacks arrivals requireds slews
+}] 0]
+puts "timing arrays [format %.1f [expr { $usecs / 1000.0 }]]ms [llength $pins] pins"
+
+write_timing_arrays -all_endpoints gcd_timing_arrays.bin
+puts "wrote gcd_timing_arrays.bin [file size gcd_timing_arrays.bin] bytes"
@@ -0,0 +1,16 @@
+# write_timing_model thread benchmark
+read_liberty sky130hd_tt.lib.gz
+read_verilog gcd_sky130hd.v
+link_design gcd
+
+read_sdc gcd_sky130hd.sdc
+set_propagated_clock clk
+read_spef gcd_sky130hd.spef
+
+set model_file [file join [pwd] gcd_model.lib]
+foreach threads [list 1 [sta::processor_count]] {
+  set usecs [lindex [time {write_timing_model -threads $threads $model_file}] 0]
+  puts [format "write_timing_model -threads %d %.3f seconds" \
+          $threads [expr $usecs * 1e-6]]
+}
+file delete $model_file
@@ -0,0 +1,35 @@
+# Evaluate upsizing each nand2_1 in gcd with what-if sessions and
+# compare the time against undoing each replace_cell by hand. Run with
+#  sta -exit what_if.tcl
+read_liberty sky130hd_tt.lib.gz
+read_verilog gcd_sky130hd.v
+link_design gcd
+read_sdc gcd_sky130hd.sdc
+read_spef gcd_sky130hd.spef
+
+set insts [get_cells -filter "ref_name == sky130_fd_sc_hd__nand2_1"]
+set base_slack [worst_slack -max]
+
+set usecs [lindex [time {
+  foreach inst $insts {
+    replace_cell $inst sky130_fd_sc_hd__nand2_2
+    set slack [worst_slack -max]
+    replace_cell $inst sky130_fd_sc_hd__nand2_1
+  }
+}] 0]
+puts "replace_cell undo [format %.1f [expr { $usecs / 1000.0 }]]ms"
+
+set usecs [lindex [time {
+  foreach inst $insts {
+    begin_what_if
+    replace_cell $inst sky130_fd_sc_hd__nand2_2
+    set slack($inst) [worst_slack -max]
+    discard_what_if
+  }
+}] 0]
+puts "what-if discard   [format %.1f [expr { $usecs / 1000.0 }]]ms"
+
+foreach inst $insts {
+  puts "[get_full_name $inst] [format %.3f [expr { $slack($inst) - $base_slack }]]"
+}
+puts "worst slack [format %.3f [worst_slack -max]] base [format %.3f $base_slack]"
@@ -24,8 +24,11 @@
 
 #include "Graph.hh"
 
+#include <algorithm>
+
 #include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "FuncExpr.hh"
 #include "Liberty.hh"
 #include "MinMax.hh"
@@ -60,6 +63,7 @@ Graph::Graph(StaState *sta,
 
 Graph::~Graph()
 {
+  deleteDelayAnnotations();
   edges_->clear();
   delete edges_;
   vertices_->clear();
@@ -71,8 +75,12 @@ void
 Graph::makeGraph()
 {
   Stats stats(debug_, report_);
-  makeVerticesAndEdges();
-  makeWireEdges();
+  if (thread_count_ > 1)
+    makeGraphParallel();
+  else {
+    makeVerticesAndEdges();
+    makeWireEdges();
+  }
   stats.report("Make graph");
 }
 
@@ -96,6 +104,300 @@ Graph::makeVerticesAndEdges()
   makePinVertices(network_->topInstance());
 }
 
+////////////////////////////////////////////////////////////////
+
+// Wire edges made from an instance pin when the graph is made in parallel.
+class PinWireEdges
+{
+public:
+  const Pin *pin;
+  // Net drivers and loads when pin is the first net driver.
+  PinSeq drvrs;
+  PinSeq loads;
+  // Top level bidirect port load to driver edge.
+  bool port_edge;
+};
+
+// Instances visited by a thread below this count are made serially.
+static constexpr size_t graph_thread_min_count = 1000;
+
+// Make the same vertices and edges with the same ids and edge order
+// as makeVerticesAndEdges() and makeWireEdges().
+// The first pass over the instances counts the vertices and edges of
+// each instance so consecutive id ranges can be reserved in instance
+// order. The second pass makes the vertices and edges in the ranges.
+// Instance edges only connect vertices of the instance and each net is
+// made by one thread, so the edges can be linked to their vertices in
+// parallel. Wire edges are made after all instance edges so the vertex
+// edge lists are in the same order as the serial builder.
+void
+Graph::makeGraphParallel()
+{
+  vertices_ = new VertexTable;
+  edges_ = new EdgeTable;
+  // makeEdge does not invalidate the adjacency for reserved edges
+  // because it is called from multiple threads.
+  adjacencyChanged();
+
+  InstanceSeq insts;
+  LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
+  while (leaf_iter->hasNext())
+    insts.push_back(leaf_iter->next());
+  delete leaf_iter;
+  insts.push_back(network_->topInstance());
+  size_t inst_count = insts.size();
+
+  // Instance vertex and edge counts converted to offsets.
+  std::vector<size_t> vertex_offsets(inst_count + 1, 0);
+  std::vector<size_t> edge_offsets(inst_count + 1, 0);
+  auto count_inst = [&] (size_t, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      const Instance *inst = insts[i];
+      vertex_offsets[i + 1] = instVertexCount(inst);
+      edge_offsets[i + 1] = instEdgeCount(inst);
+    }
+  };
+  if (thread_count_ > 1 && inst_count >= graph_thread_min_count)
+    dispatch_queue_->parallelFor(inst_count, 0, count_inst);
+  else
+    count_inst(0, 0, inst_count);
+  for (size_t i = 0; i < inst_count; i++) {
+    vertex_offsets[i + 1] += vertex_offsets[i];
+    edge_offsets[i + 1] += edge_offsets[i];
+  }
+
+  VertexId vertex_id = vertices_->make(vertex_offsets[inst_count]);
+  std::vector<PinVertexSeq> thread_bidirect_drvrs(thread_count_);
+  std::vector<VertexSeq> thread_reg_clks(thread_count_);
+  auto make_vertices = [&] (size_t thread, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++)
+      makeInstVertices(insts[i], vertex_id + vertex_offsets[i],
+                       thread_bidirect_drvrs[thread], thread_reg_clks[thread]);
+  };
+  if (thread_count_ > 1 && inst_count >= graph_thread_min_count)
+    dispatch_queue_->parallelFor(inst_count, 0, make_vertices);
+  else
+    make_vertices(0, 0, inst_count);
+  for (const PinVertexSeq &bidirect_drvrs : thread_bidirect_drvrs) {
+    for (const auto &[pin, vertex] : bidirect_drvrs)
+      pin_bidirect_drvr_vertex_map_[pin] = vertex;
+  }
+  for (const VertexSeq &reg_clks : thread_reg_clks)
+    reg_clk_vertices_.insert(reg_clks.begin(), reg_clks.end());
+
+  EdgeId edge_id = edges_->make(edge_offsets[inst_count]);
+  arc_delay_annotated_bits_.resize(edges_->idBound());
+  auto make_edges = [&] (size_t, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      const Instance *inst = insts[i];
+      LibertyCell *cell = network_->libertyCell(inst);
+      if (cell) {
+        EdgeId inst_edge_id = edge_id + edge_offsets[i];
+        makePortInstanceEdges(inst, cell, nullptr, &inst_edge_id);
+      }
+    }
+  };
+  if (thread_count_ > 1 && inst_count >= graph_thread_min_count)
+    dispatch_queue_->parallelFor(inst_count, 0, make_edges);
+  else
+    make_edges(0, 0, inst_count);
+
+  // Wire edges counts converted to offsets.
+  std::vector<PinWireEdgesSeq> inst_wire_edges(inst_count);
+  std::vector<size_t> wire_offsets(inst_count + 1, 0);
+  auto find_wire_edges = [&] (size_t, size_t from, size_t to) {
+    PinSet visited_drvrs(network_);
+    for (size_t i = from; i < to; i++)
+      wire_offsets[i + 1] = findInstWireEdges(insts[i], visited_drvrs,
+                                              inst_wire_edges[i]);
+  };
+  if (thread_count_ > 1 && inst_count >= graph_thread_min_count)
+    dispatch_queue_->parallelFor(inst_count, 0, find_wire_edges);
+  else
+    find_wire_edges(0, 0, inst_count);
+  for (size_t i = 0; i < inst_count; i++) {
+    wire_offsets[i + 1] += wire_offsets[i];
+    for (const PinWireEdges &wire_edges : inst_wire_edges[i]) {
+      if (wire_edges.drvrs.empty() && !wire_edges.port_edge)
+        debugPrint(debug_, "graph", 1, "ignoring isolated driver {}",
+                   network_->pathName(wire_edges.pin));
+    }
+  }
+
+  EdgeId wire_edge_id = edges_->make(wire_offsets[inst_count]);
+  arc_delay_annotated_bits_.resize(edges_->idBound());
+  auto make_wire_edges = [&] (size_t, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++)
+      makeInstWireEdges(inst_wire_edges[i], wire_edge_id + wire_offsets[i]);
+  };
+  if (thread_count_ > 1 && inst_count >= graph_thread_min_count)
+    dispatch_queue_->parallelFor(inst_count, 0, make_wire_edges);
+  else
+    make_wire_edges(0, 0, inst_count);
+}
+
+size_t
+Graph::instVertexCount(const Instance *inst) const
+{
+  size_t vertex_count = 0;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    PortDirection *dir = network_->direction(pin);
+    if (!dir->isPowerGround())
+      vertex_count += dir->isBidirect() ? 2 : 1;
+  }
+  delete pin_iter;
+  return vertex_count;
+}
+
+// Count the edges made by makePortInstanceEdges.
+size_t
+Graph::instEdgeCount(const Instance *inst) const
+{
+  size_t edge_count = 0;
+  LibertyCell *cell = network_->libertyCell(inst);
+  if (cell) {
+    for (TimingArcSet *arc_set : cell->timingArcSets()) {
+      LibertyPort *from_port = arc_set->from();
+      LibertyPort *to_port = arc_set->to();
+      if (from_port) {
+        Pin *from_pin = network_->findPin(inst, from_port);
+        Pin *to_pin = network_->findPin(inst, to_port);
+        if (from_pin && to_pin) {
+          PortDirection *from_dir = network_->direction(from_pin);
+          PortDirection *to_dir = network_->direction(to_pin);
+          bool from_vertex = !from_dir->isPowerGround();
+          bool to_vertex = !to_dir->isPowerGround();
+          if (from_vertex) {
+            bool is_check = arc_set->role()->isTimingCheckBetween();
+            if ((to_dir->isBidirect() && !is_check)
+                || to_vertex)
+              edge_count++;
+            if (from_dir->isBidirect() && to_vertex)
+              edge_count++;
+          }
+        }
+      }
+    }
+  }
+  return edge_count;
+}
+
+void
+Graph::makeInstVertices(const Instance *inst,
+                        VertexId vertex_id,
+                        // Return values.
+                        PinVertexSeq &bidirect_drvr_vertices,
+                        VertexSeq &reg_clk_vertices)
+{
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    Pin *pin = pin_iter->next();
+    PortDirection *dir = network_->direction(pin);
+    if (!dir->isPowerGround()) {
+      bool is_reg_clk = network_->isRegClkPin(pin);
+      Vertex *vertex = Graph::vertex(vertex_id++);
+      vertex->init(pin, false, is_reg_clk);
+      initSlews(vertex);
+      network_->setVertexId(pin, id(vertex));
+      if (is_reg_clk)
+        reg_clk_vertices.push_back(vertex);
+      if (dir->isBidirect()) {
+        Vertex *bidir_drvr_vertex = Graph::vertex(vertex_id++);
+        bidir_drvr_vertex->init(pin, true, is_reg_clk);
+        initSlews(bidir_drvr_vertex);
+        bidirect_drvr_vertices.emplace_back(pin, bidir_drvr_vertex);
+        if (is_reg_clk)
+          reg_clk_vertices.push_back(bidir_drvr_vertex);
+      }
+    }
+  }
+  delete pin_iter;
+}
+
+// Find the wire edges makeInstDrvrWireEdges would make for an instance.
+// A net is made by its first driver in pin iteration order, which is
+// the driver with the lowest vertex id.
+// Return the edge count.
+size_t
+Graph::findInstWireEdges(const Instance *inst,
+                         PinSet &visited_drvrs,
+                         // Return value.
+                         PinWireEdgesSeq &wire_edges) const
+{
+  size_t edge_count = 0;
+  bool is_top = network_->isTopInstance(inst);
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    if (network_->isDriver(pin)) {
+      PinSeq drvrs, loads;
+      visited_drvrs.clear();
+      FindNetDrvrLoads visitor(pin, visited_drvrs, loads, drvrs, network_);
+      network_->visitConnectedPins(pin, visitor);
+      VertexId pin_vertex_id = network_->vertexId(pin);
+      bool first_drvr = true;
+      for (const Pin *drvr : drvrs) {
+        if (drvr != pin
+            && network_->vertexId(drvr) < pin_vertex_id) {
+          first_drvr = false;
+          break;
+        }
+      }
+      if (first_drvr) {
+        if (isIsolatedNet(drvrs, loads)) {
+          for (const Pin *drvr : drvrs)
+            wire_edges.push_back({drvr, {}, {}, false});
+        }
+        else {
+          for (const Pin *drvr : drvrs) {
+            if (network_->vertexId(drvr) != vertex_id_null) {
+              for (const Pin *load : loads) {
+                if (drvr != load && pinLoadVertex(load))
+                  edge_count++;
+              }
+            }
+          }
+          wire_edges.push_back({pin, std::move(drvrs), std::move(loads), false});
+        }
+      }
+    }
+    if (is_top
+        && network_->direction(pin)->isBidirect()) {
+      wire_edges.push_back({pin, {}, {}, true});
+      edge_count++;
+    }
+  }
+  delete pin_iter;
+  return edge_count;
+}
+
+void
+Graph::makeInstWireEdges(const PinWireEdgesSeq &wire_edges,
+                         EdgeId edge_id)
+{
+  for (const PinWireEdges &pin_wire_edges : wire_edges) {
+    if (pin_wire_edges.port_edge) {
+      Vertex *bidir_load, *bidir_drvr;
+      pinVertices(pin_wire_edges.pin, bidir_load, bidir_drvr);
+      Edge *edge = makeEdge(bidir_load, bidir_drvr,
+                            TimingArcSet::wireTimingArcSet(), &edge_id);
+      edge->setIsBidirectPortPath(true);
+    }
+    else {
+      for (const Pin *drvr : pin_wire_edges.drvrs) {
+        for (const Pin *load : pin_wire_edges.loads) {
+          if (drvr != load)
+            makeWireEdge(drvr, load, &edge_id);
+        }
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
 class FindNetDrvrLoadCounts : public PinVisitor
 {
 public:
@@ -163,7 +465,7 @@ Graph::makeInstanceEdges(const Instance *inst)
 {
   LibertyCell *cell = network_->libertyCell(inst);
   if (cell)
-    makePortInstanceEdges(inst, cell, nullptr);
+    makePortInstanceEdges(inst, cell, nullptr, nullptr);
 }
 
 void
@@ -174,15 +476,18 @@ Graph::makePinInstanceEdges(const Pin *pin)
     LibertyCell *cell = network_->libertyCell(inst);
     if (cell) {
       LibertyPort *port = network_->libertyPort(pin);
-      makePortInstanceEdges(inst, cell, port);
+      makePortInstanceEdges(inst, cell, port, nullptr);
     }
   }
 }
 
+// Make edges with consecutive reserved ids starting at edge_id when
+// it is not null.
 void
 Graph::makePortInstanceEdges(const Instance *inst,
                              LibertyCell *cell,
-                             LibertyPort *from_to_port)
+                             LibertyPort *from_to_port,
+                             EdgeId *edge_id)
 {
   for (TimingArcSet *arc_set : cell->timingArcSets()) {
     LibertyPort *from_port = arc_set->from();
@@ -207,9 +512,9 @@ Graph::makePortInstanceEdges(const Instance *inst,
           const TimingRole *role = arc_set->role();
           bool is_check = role->isTimingCheckBetween();
           if (to_bidirect_drvr_vertex && !is_check)
-            makeEdge(from_vertex, to_bidirect_drvr_vertex, arc_set);
+            makeEdge(from_vertex, to_bidirect_drvr_vertex, arc_set, edge_id);
           else if (to_vertex) {
-            makeEdge(from_vertex, to_vertex, arc_set);
+            makeEdge(from_vertex, to_vertex, arc_set, edge_id);
             if (is_check) {
               to_vertex->setHasChecks(true);
               from_vertex->setIsCheckClk(true);
@@ -219,7 +524,7 @@ Graph::makePortInstanceEdges(const Instance *inst,
             // Internal path from bidirect output back into the
             // instance.
             Edge *edge = makeEdge(from_bidirect_drvr_vertex, to_vertex,
-                                  arc_set);
+                                  arc_set, edge_id);
             edge->setIsBidirectInstPath(true);
           }
         }
@@ -378,6 +683,14 @@ Graph::makeWireEdgesThruPin(const Pin *hpin)
 void
 Graph::makeWireEdge(const Pin *from_pin,
                     const Pin *to_pin)
+{
+  makeWireEdge(from_pin, to_pin, nullptr);
+}
+
+void
+Graph::makeWireEdge(const Pin *from_pin,
+                    const Pin *to_pin,
+                    EdgeId *edge_id)
 {
   TimingArcSet *arc_set = TimingArcSet::wireTimingArcSet();
   Vertex *from_vertex, *from_bidirect_drvr_vertex;
@@ -386,9 +699,9 @@ Graph::makeWireEdge(const Pin *from_pin,
   if (from_vertex && to_vertex) {
     // From and/or to can be bidirect, but edge is always from driver to load.
     if (from_bidirect_drvr_vertex)
-      makeEdge(from_bidirect_drvr_vertex, to_vertex, arc_set);
+      makeEdge(from_bidirect_drvr_vertex, to_vertex, arc_set, edge_id);
     else
-      makeEdge(from_vertex, to_vertex, arc_set);
+      makeEdge(from_vertex, to_vertex, arc_set, edge_id);
   }
 }
 
@@ -437,6 +750,7 @@ Graph::makeVertex(Pin *pin,
                   bool is_bidirect_drvr,
                   bool is_reg_clk)
 {
+  adjacencyChanged();
   Vertex *vertex = vertices_->make();
   vertex->init(pin, is_bidirect_drvr, is_reg_clk);
   initSlews(vertex);
@@ -476,6 +790,7 @@ Graph::pinLoadVertex(const Pin *pin) const
 void
 Graph::deleteVertex(Vertex *vertex)
 {
+  adjacencyChanged();
   if (vertex->isRegClk())
     reg_clk_vertices_.erase(vertex);
   Pin *pin = vertex->pin_;
@@ -490,6 +805,8 @@ Graph::deleteVertex(Vertex *vertex)
     Edge *edge = Graph::edge(edge_id);
     next_id = edge->vertex_in_next_;
     deleteOutEdge(edge->from(this), edge);
+    deleteDelayAnnotated(edge);
+    deleteSavedDelays(edge);
     edge->clear();
     edges_->destroy(edge);
   }
@@ -498,9 +815,12 @@ Graph::deleteVertex(Vertex *vertex)
     Edge *edge = Graph::edge(edge_id);
     next_id = edge->vertex_out_next_;
     deleteInEdge(edge->to(this), edge);
+    deleteDelayAnnotated(edge);
+    deleteSavedDelays(edge);
     edge->clear();
     edges_->destroy(edge);
   }
+  deleteSavedDelays(vertex);
   vertex->clear();
   vertices_->destroy(vertex);
 }
@@ -542,6 +862,103 @@ Graph::deleteOutEdge(Vertex *vertex,
     Graph::edge(next)->vertex_out_prev_ = prev;
 }
 
+////////////////////////////////////////////////////////////////
+
+void
+Graph::freezeAdjacency()
+{
+  Stats stats(debug_, report_);
+  adjacency_frozen_ = false;
+  VertexSeq vertices;
+  VertexIterator vertex_iter(this);
+  while (vertex_iter.hasNext())
+    vertices.push_back(vertex_iter.next());
+
+  // Edge counts converted to offsets.
+  size_t vertex_id_bound = vertexIdBound();
+  frozen_in_offsets_.assign(vertex_id_bound + 1, 0);
+  frozen_out_offsets_.assign(vertex_id_bound + 1, 0);
+  auto count_edges = [&] (size_t, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      Vertex *vertex = vertices[i];
+      VertexId vertex_id = id(vertex);
+      EdgeId in_count = 0;
+      for (EdgeId edge_id = vertex->in_edges_; edge_id;
+           edge_id = edge(edge_id)->vertex_in_next_)
+        in_count++;
+      EdgeId out_count = 0;
+      for (EdgeId edge_id = vertex->out_edges_; edge_id;
+           edge_id = edge(edge_id)->vertex_out_next_)
+        out_count++;
+      frozen_in_offsets_[vertex_id + 1] = in_count;
+      frozen_out_offsets_[vertex_id + 1] = out_count;
+    }
+  };
+  if (thread_count_ > 1 && vertices.size() >= graph_thread_min_count)
+    dispatch_queue_->parallelFor(vertices.size(), 0, count_edges);
+  else
+    count_edges(0, 0, vertices.size());
+  for (size_t i = 0; i < vertex_id_bound; i++) {
+    frozen_in_offsets_[i + 1] += frozen_in_offsets_[i];
+    frozen_out_offsets_[i + 1] += frozen_out_offsets_[i];
+  }
+
+  frozen_in_edges_.resize(frozen_in_offsets_[vertex_id_bound]);
+  frozen_out_edges_.resize(frozen_out_offsets_[vertex_id_bound]);
+  auto copy_edges = [&] (size_t, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      Vertex *vertex = vertices[i];
+      VertexId vertex_id = id(vertex);
+      EdgeId in_index = frozen_in_offsets_[vertex_id];
+      for (EdgeId edge_id = vertex->in_edges_; edge_id;
+           edge_id = edge(edge_id)->vertex_in_next_)
+        frozen_in_edges_[in_index++] = edge(edge_id);
+      EdgeId out_index = frozen_out_offsets_[vertex_id];
+      for (EdgeId edge_id = vertex->out_edges_; edge_id;
+           edge_id = edge(edge_id)->vertex_out_next_)
+        frozen_out_edges_[out_index++] = edge(edge_id);
+    }
+  };
+  if (thread_count_ > 1 && vertices.size() >= graph_thread_min_count)
+    dispatch_queue_->parallelFor(vertices.size(), 0, copy_edges);
+  else
+    copy_edges(0, 0, vertices.size());
+  adjacency_frozen_ = true;
+  debugPrint(debug_, "graph", 1, "froze adjacency {} edges",
+             frozen_out_edges_.size());
+  stats.report("Freeze graph adjacency");
+}
+
+void
+Graph::ensureFrozenAdjacency()
+{
+  if (!adjacency_frozen_
+      && variables_->graphFrozenAdjacency())
+    freezeAdjacency();
+}
+
+void
+Graph::deleteFrozenAdjacency()
+{
+  adjacency_frozen_ = false;
+  frozen_in_offsets_ = {};
+  frozen_in_edges_ = {};
+  frozen_out_offsets_ = {};
+  frozen_out_edges_ = {};
+}
+
+// Iterators use the edge lists until the adjacency is frozen again.
+void
+Graph::adjacencyChanged()
+{
+  if (adjacency_frozen_) {
+    debugPrint(debug_, "graph", 1, "frozen adjacency invalid");
+    adjacency_frozen_ = false;
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
 void
 Graph::gateEdgeArc(const Pin *in_pin,
                    const RiseFall *in_rf,
@@ -679,6 +1096,8 @@ Graph::setSlew(Vertex *vertex,
                DcalcAPIndex ap_index,
                const Slew &slew)
 {
+  if (saving_delays_)
+    saveSlews(vertex);
   size_t slew_index = ap_index * RiseFall::index_count + rf->index();
   if (variables_->pocvEnabled()) {
     Slew *slews = vertex->slews();
@@ -709,7 +1128,21 @@ Graph::makeEdge(Vertex *from,
                 Vertex *to,
                 TimingArcSet *arc_set)
 {
-  Edge *edge = edges_->make();
+  return makeEdge(from, to, arc_set, nullptr);
+}
+
+// Use the reserved edge with id *reserved_id and increment it when
+// reserved_id is not null. Reserved edges are made by makeGraphParallel,
+// which invalidates the adjacency before the threads run.
+Edge *
+Graph::makeEdge(Vertex *from,
+                Vertex *to,
+                TimingArcSet *arc_set,
+                EdgeId *reserved_id)
+{
+  if (reserved_id == nullptr)
+    adjacencyChanged();
+  Edge *edge = reserved_id ? Graph::edge((*reserved_id)++) : edges_->make();
   edge->init(id(from), id(to), arc_set);
   // Add out edge to from vertex.
   EdgeId next = from->out_edges_;
@@ -725,16 +1158,20 @@ Graph::makeEdge(Vertex *from,
   to->in_edges_ = edge_id;
 
   initArcDelays(edge);
+  initDelayAnnotated(edge);
   return edge;
 }
 
 void
 Graph::deleteEdge(Edge *edge)
 {
+  adjacencyChanged();
   Vertex *from = edge->from(this);
   Vertex *to = edge->to(this);
   deleteOutEdge(from, edge);
   deleteInEdge(to, edge);
+  deleteDelayAnnotated(edge);
+  deleteSavedDelays(edge);
   edge->clear();
   edges_->destroy(edge);
 }
@@ -761,6 +1198,8 @@ Graph::setArcDelay(Edge *edge,
                    DcalcAPIndex ap_index,
                    const ArcDelay &delay)
 {
+  if (saving_delays_)
+    saveArcDelays(edge);
   size_t index = arc->index() * ap_count_ + ap_index;
   if (variables_->pocvEnabled()) {
     ArcDelay *delays = reinterpret_cast<ArcDelay*>(edge->arcDelays());
@@ -794,6 +1233,8 @@ Graph::setWireArcDelay(Edge *edge,
                        DcalcAPIndex ap_index,
                        const ArcDelay &delay)
 {
+  if (saving_delays_)
+    saveArcDelays(edge);
   size_t index = rf->index() * ap_count_ + ap_index;
   if (variables_->pocvEnabled()) {
     ArcDelay *delays = reinterpret_cast<ArcDelay*>(edge->arcDelays());
@@ -812,16 +1253,41 @@ Graph::arcDelayAnnotated(const Edge *edge,
                          const TimingArc *arc,
                          DcalcAPIndex ap_index) const
 {
-  return edge->arcDelayAnnotated(arc, ap_index, ap_count_);
+  size_t index = arc->index() * ap_count_ + ap_index;
+  EdgeId edge_id = id(edge);
+  if (edge->arc_delay_annotated_is_bits_)
+    return arc_delay_annotated_bits_[edge_id] & arcDelayAnnotateBit(index);
+  else
+    return (*arcDelayAnnotatedSeq(edge_id))[index];
 }
 
+// Edges are annotated in parallel by read_sdf so the bits are in a
+// vector that is resized when edges are made. Bit vectors for wide
+// edges are made with the edge, so no locks are needed.
 void
 Graph::setArcDelayAnnotated(Edge *edge,
                             const TimingArc *arc,
                             DcalcAPIndex ap_index,
                             bool annotated)
 {
-  edge->setArcDelayAnnotated(arc, ap_index, ap_count_, annotated);
+  size_t index = arc->index() * ap_count_ + ap_index;
+  EdgeId edge_id = id(edge);
+  if (edge->arc_delay_annotated_is_bits_) {
+    uintptr_t &bits = arc_delay_annotated_bits_[edge_id];
+    if (annotated)
+      bits |= arcDelayAnnotateBit(index);
+    else
+      bits &= ~arcDelayAnnotateBit(index);
+  }
+  else
+    (*arcDelayAnnotatedSeq(edge_id))[index] = annotated;
+}
+
+// Wide edges keep a bit vector pointer in arc_delay_annotated_bits_.
+std::vector<bool> *
+Graph::arcDelayAnnotatedSeq(EdgeId edge_id) const
+{
+  return reinterpret_cast<std::vector<bool>*>(arc_delay_annotated_bits_[edge_id]);
 }
 
 bool
@@ -831,7 +1297,7 @@ Graph::wireDelayAnnotated(const Edge *edge,
 {
   int arc_index = TimingArcSet::wireArcIndex(rf);
   TimingArc *arc = TimingArcSet::wireTimingArcSet()->findTimingArc(arc_index);
-  return edge->arcDelayAnnotated(arc, ap_index, ap_count_);
+  return arcDelayAnnotated(edge, arc, ap_index);
 }
 
 void
@@ -842,13 +1308,161 @@ Graph::setWireDelayAnnotated(Edge *edge,
 {
   int arc_index = TimingArcSet::wireArcIndex(rf);
   TimingArc *arc = TimingArcSet::wireTimingArcSet()->findTimingArc(arc_index);
-  edge->setArcDelayAnnotated(arc, ap_index, ap_count_, annotated);
+  setArcDelayAnnotated(edge, arc, ap_index, annotated);
 }
 
 void
 Graph::removeDelayAnnotated(Edge *edge)
 {
   edge->removeDelayAnnotated();
+  EdgeId edge_id = id(edge);
+  if (edge->arc_delay_annotated_is_bits_)
+    arc_delay_annotated_bits_[edge_id] = 0;
+  else {
+    std::vector<bool> *seq = arcDelayAnnotatedSeq(edge_id);
+    std::fill(seq->begin(), seq->end(), false);
+  }
+}
+
+// Edges with more arcs * analysis points than bits in a word get a
+// bit vector when they are made so readers never see it change.
+void
+Graph::initDelayAnnotated(Edge *edge)
+{
+  EdgeId edge_id = id(edge);
+  if (edge_id >= arc_delay_annotated_bits_.size())
+    arc_delay_annotated_bits_.resize(edges_->idBound());
+  size_t bit_count = edge->timingArcSet()->arcCount() * ap_count_;
+  if (bit_count > sizeof(uintptr_t) * 8) {
+    std::vector<bool> *seq = new std::vector<bool>(bit_count);
+    arc_delay_annotated_bits_[edge_id] = reinterpret_cast<uintptr_t>(seq);
+    edge->arc_delay_annotated_is_bits_ = false;
+  }
+  else {
+    arc_delay_annotated_bits_[edge_id] = 0;
+    edge->arc_delay_annotated_is_bits_ = true;
+  }
+}
+
+void
+Graph::deleteDelayAnnotated(Edge *edge)
+{
+  EdgeId edge_id = id(edge);
+  if (!edge->arc_delay_annotated_is_bits_) {
+    delete arcDelayAnnotatedSeq(edge_id);
+    edge->arc_delay_annotated_is_bits_ = true;
+  }
+  arc_delay_annotated_bits_[edge_id] = 0;
+}
+
+void
+Graph::deleteDelayAnnotations()
+{
+  VertexIterator vertex_iter(this);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    VertexOutEdgeIterator edge_iter(vertex, this);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      deleteDelayAnnotated(edge);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+Graph::saveDelays()
+{
+  saving_delays_ = true;
+}
+
+size_t
+Graph::delayFloatCount() const
+{
+  return variables_->pocvEnabled() ? sizeof(Delay) / sizeof(float) : 1;
+}
+
+// Called by delay calculation threads. Each vertex and edge is set
+// many times, so only the first save takes the exclusive lock.
+void
+Graph::saveSlews(Vertex *vertex)
+{
+  VertexId vertex_id = id(vertex);
+  {
+    std::shared_lock lock(saved_slews_lock_);
+    if (saved_slews_.contains(vertex_id))
+      return;
+  }
+  const float *slews = vertex->slewsFloat();
+  size_t float_count = slewCount() * delayFloatCount();
+  std::unique_lock lock(saved_slews_lock_);
+  saved_slews_.try_emplace(vertex_id, slews, slews + float_count);
+}
+
+void
+Graph::saveArcDelays(Edge *edge)
+{
+  EdgeId edge_id = id(edge);
+  {
+    std::shared_lock lock(saved_arc_delays_lock_);
+    if (saved_arc_delays_.contains(edge_id))
+      return;
+  }
+  const float *delays = edge->arcDelays();
+  size_t float_count = edge->timingArcSet()->arcCount() * ap_count_
+    * delayFloatCount();
+  std::unique_lock lock(saved_arc_delays_lock_);
+  saved_arc_delays_.try_emplace(edge_id, delays, delays + float_count);
+}
+
+void
+Graph::restoreDelays(// Return value.
+                     VertexSeq &restored)
+{
+  saving_delays_ = false;
+  for (const auto &[vertex_id, slews] : saved_slews_) {
+    Vertex *vertex = Graph::vertex(vertex_id);
+    std::copy(slews.begin(), slews.end(), vertex->slewsFloat());
+    restored.push_back(vertex);
+  }
+  for (const auto &[edge_id, delays] : saved_arc_delays_) {
+    Edge *edge = Graph::edge(edge_id);
+    std::copy(delays.begin(), delays.end(), edge->arcDelays());
+    restored.push_back(edge->from(this));
+    restored.push_back(edge->to(this));
+  }
+  saved_slews_.clear();
+  saved_arc_delays_.clear();
+}
+
+void
+Graph::deleteSavedDelays()
+{
+  saving_delays_ = false;
+  saved_slews_.clear();
+  saved_arc_delays_.clear();
+}
+
+// Deleted vertex and edge ids are reused, so forget their saved delays.
+void
+Graph::deleteSavedDelays(Vertex *vertex)
+{
+  if (saving_delays_)
+    saved_slews_.erase(id(vertex));
+}
+
+void
+Graph::deleteSavedDelays(Edge *edge)
+{
+  if (saving_delays_)
+    saved_arc_delays_.erase(id(edge));
+}
+
+uintptr_t
+Graph::arcDelayAnnotateBit(size_t index)
+{
+  return static_cast<uintptr_t>(1) << index;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -859,6 +1473,8 @@ Graph::delayCountChanged()
   ap_count_ = dcalcAnalysisPtCount();
   // Discard any existing delays.
   removePeriodCheckAnnotations();
+  saved_slews_.clear();
+  saved_arc_delays_.clear();
   initSlews();
 }
 
@@ -874,6 +1490,9 @@ Graph::initSlews()
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
       initArcDelays(edge);
+      // The annotation bit count depends on the analysis point count.
+      deleteDelayAnnotated(edge);
+      initDelayAnnotated(edge);
     }
   }
 }
@@ -998,6 +1617,12 @@ Graph::setPeriodCheckAnnotation(const Pin *pin,
   periods[ap_index] = period;
 }
 
+const float *
+Graph::periodCheckAnnotations(const Pin *pin) const
+{
+  return findKey(period_check_annotations_, pin);
+}
+
 void
 Graph::removePeriodCheckAnnotations()
 {
@@ -1308,7 +1933,6 @@ Edge::init(VertexId from,
   arc_set_ = arc_set;
   arc_delays_ = nullptr;
   arc_delay_annotated_is_bits_ = true;
-  arc_delay_annotated_.bits_ = 0;
   from_ = from;
   to_ = to;
   vertex_in_next_ = edge_id_null;
@@ -1333,10 +1957,6 @@ Edge::clear()
 {
   delete [] arc_delays_;
   arc_delays_ = nullptr;
-  if (!arc_delay_annotated_is_bits_)
-    delete arc_delay_annotated_.seq_;
-  arc_delay_annotated_is_bits_ = true;
-  arc_delay_annotated_.seq_ = nullptr;
 }
 
 void
@@ -1375,51 +1995,10 @@ Edge::setArcDelays(float *delays)
   arc_delays_ = delays;
 }
 
-bool
-Edge::arcDelayAnnotated(const TimingArc *arc,
-                        DcalcAPIndex ap_index,
-                        DcalcAPIndex ap_count) const
-{
-  size_t index = arc->index() * ap_count + ap_index;
-  if (arc_delay_annotated_is_bits_)
-    return arc_delay_annotated_.bits_ & arcDelayAnnotateBit(index);
-  else
-    return (*arc_delay_annotated_.seq_)[index];
-}
-
-void
-Edge::setArcDelayAnnotated(const TimingArc *arc,
-                           DcalcAPIndex ap_index,
-                           DcalcAPIndex ap_count,
-                           bool annotated)
-{
-  size_t index = arc->index() * ap_count + ap_index;
-  if (index > sizeof(uintptr_t) * 8
-      && arc_delay_annotated_is_bits_) {
-    arc_delay_annotated_is_bits_ = false;
-    size_t bit_count = ap_count * RiseFall::index_count * 2;
-    arc_delay_annotated_.seq_ = new std::vector<bool>(bit_count);
-  }
-  if (arc_delay_annotated_is_bits_) {
-    if (annotated)
-      arc_delay_annotated_.bits_ |= arcDelayAnnotateBit(index);
-    else
-      arc_delay_annotated_.bits_ &= ~arcDelayAnnotateBit(index);
-  }
-  else
-    (*arc_delay_annotated_.seq_)[index] = annotated;
-}
-
 void
 Edge::removeDelayAnnotated()
 {
   delay_annotation_is_incremental_ = false;
-  if (arc_delay_annotated_is_bits_)
-    arc_delay_annotated_.bits_ = 0;
-  else {
-    delete arc_delay_annotated_.seq_;
-    arc_delay_annotated_.seq_ = nullptr;
-  }
 }
 
 void
@@ -1428,12 +2007,6 @@ Edge::setDelayAnnotationIsIncremental(bool is_incr)
   delay_annotation_is_incremental_ = is_incr;
 }
 
-uintptr_t
-Edge::arcDelayAnnotateBit(size_t index)
-{
-  return static_cast<uintptr_t>(1) << index;
-}
-
 const TimingRole *
 Edge::role() const
 {
@@ -1562,21 +2135,42 @@ VertexIterator::findNext()
 
 VertexInEdgeIterator::VertexInEdgeIterator(Vertex *vertex,
                                            const Graph *graph) :
-  next_(graph->edge(vertex->in_edges_)),
   graph_(graph)
 {
+  init(graph->id(vertex));
 }
 
 VertexInEdgeIterator::VertexInEdgeIterator(VertexId vertex_id,
                                            const Graph *graph) :
-  next_(graph->edge(graph->vertex(vertex_id)->in_edges_)),
   graph_(graph)
 {
+  init(vertex_id);
+}
+
+void
+VertexInEdgeIterator::init(VertexId vertex_id)
+{
+  if (graph_->adjacency_frozen_) {
+    Edge *const *edges = graph_->frozen_in_edges_.data();
+    frozen_next_ = edges + graph_->frozen_in_offsets_[vertex_id];
+    frozen_end_ = edges + graph_->frozen_in_offsets_[vertex_id + 1];
+  }
+  else
+    next_ = graph_->edge(graph_->vertex(vertex_id)->in_edges_);
+}
+
+bool
+VertexInEdgeIterator::hasNext()
+{
+  return next_ != nullptr
+    || frozen_next_ != frozen_end_;
 }
 
 Edge *
 VertexInEdgeIterator::next()
 {
+  if (frozen_next_ != frozen_end_)
+    return *frozen_next_++;
   Edge *next = next_;
   if (next_)
     next_ = graph_->edge(next_->vertex_in_next_);
@@ -1585,14 +2179,30 @@ VertexInEdgeIterator::next()
 
 VertexOutEdgeIterator::VertexOutEdgeIterator(Vertex *vertex,
                                              const Graph *graph) :
-  next_(graph->edge(vertex->out_edges_)),
   graph_(graph)
 {
+  if (graph->adjacency_frozen_) {
+    VertexId vertex_id = graph->id(vertex);
+    Edge *const *edges = graph->frozen_out_edges_.data();
+    frozen_next_ = edges + graph->frozen_out_offsets_[vertex_id];
+    frozen_end_ = edges + graph->frozen_out_offsets_[vertex_id + 1];
+  }
+  else
+    next_ = graph->edge(vertex->out_edges_);
+}
+
+bool
+VertexOutEdgeIterator::hasNext()
+{
+  return next_ != nullptr
+    || frozen_next_ != frozen_end_;
 }
 
 Edge *
 VertexOutEdgeIterator::next()
 {
+  if (frozen_next_ != frozen_end_)
+    return *frozen_next_++;
   Edge *next = next_;
   if (next_)
     next_ = graph_->edge(next_->vertex_out_next_);
@@ -108,6 +108,8 @@ protected:
   void checkLevel(Vertex *vertex,
                   Level level);
   void findNext(Level to_level);
+  // Profiler scope name for the levels visited by this iterator.
+  const char *profileLevelName() const;
 
   BfsIndex bfs_index_;
   Level level_min_;
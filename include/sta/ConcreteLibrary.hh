@@ -69,8 +69,9 @@ public:
                          bool is_leaf,
                          std::string_view filename);
   void deleteCell(ConcreteCell *cell);
+  // Cells that have not been read by read_liberty -lazy are not visited.
   ConcreteLibraryCellIterator *cellIterator() const;
-  ConcreteCell *findCell(std::string_view name) const;
+  virtual ConcreteCell *findCell(std::string_view name) const;
   CellSeq findCellsMatching(const PatternMatch *pattern) const;
   char busBrktLeft() const { return bus_brkt_left_; }
   char busBrktRight() const { return bus_brkt_right_; }
@@ -79,6 +80,10 @@ public:
 
 protected:
   void removeCell(ConcreteCell *cell);
+  // Hooks for libraries that read cells when they are first referenced.
+  virtual ConcreteCell *findDeferredCell(std::string_view name) const;
+  virtual void readDeferredCellsMatching(const PatternMatch *pattern) const;
+  virtual void readDeferredCells() const;
 
   std::string name_;
   std::string filename_;
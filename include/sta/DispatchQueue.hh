@@ -4,16 +4,20 @@
 // Original article: https://embeddedartistry.com/blog/2017/2/1/dispatch-queues?rq=dispatch
 //
 // Modified for OpenSTA to use C++20 non-spinning DynamicLatch for synchronization.
+// Modified for OpenSTA to run batches of tasks and index ranges with
+// worker threads that claim work with an atomic index.
+// Modified for OpenSTA to queue dispatched tasks on per worker deques
+// that idle workers steal from.
 
 #pragma once
 
 #include <atomic>
 #include <cstddef>
-#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
@@ -33,9 +37,9 @@ public:
 
   // Increases the latch count (used when a new task is dispatched)
   void
-  countUp()
+  countUp(std::ptrdiff_t n = 1)
   {
-    count_.fetch_add(1, std::memory_order_release);
+    count_.fetch_add(n, std::memory_order_release);
   }
 
   // Decreases the latch count and wakes waiting threads if it hits zero
@@ -47,6 +51,13 @@ public:
     }
   }
 
+  // True if the count is zero.
+  bool
+  tryWait() const
+  {
+    return count_.load(std::memory_order_acquire) == 0;
+  }
+
   // Blocks until the count reaches zero
   void
   wait() const
@@ -62,20 +73,52 @@ private:
   mutable std::atomic<std::ptrdiff_t> count_{0};
 };
 
+// Dispatched tasks start as soon as they are queued. Each worker has
+// a deque of dispatched tasks; workers run their own tasks newest
+// first and steal the oldest tasks of other workers when their deque
+// is empty. Tasks dispatched from a task are queued on the deque of
+// the worker running it.
+// Worker threads also run a batch of deferred tasks or ranges of
+// indices at a time. Workers claim batch tasks and ranges with an
+// atomic index, so there is no queue lock. Idle workers spin briefly
+// before sleeping.
+// deferTask, finishTasks and parallelFor are called from one thread
+// and never from a task.
 class DispatchQueue
 {
-  using fp_t = std::function<void(int thread)>;
-
 public:
+  using Task = std::function<void (size_t thread)>;
+  // thread, from, to
+  using RangeTask = std::function<void (size_t thread,
+                                        size_t from,
+                                        size_t to)>;
+
   DispatchQueue(size_t thread_count);
   ~DispatchQueue();
   void setThreadCount(size_t thread_count);
   size_t getThreadCount() const;
+  // Bind worker thread i to processor i modulo the processor count.
+  void setCpuAffinity(bool cpu_affinity);
+  bool cpuAffinity() const { return cpu_affinity_; }
+  // Start the task on a worker thread.
   // Dispatch and copy.
-  void dispatch(const fp_t& op);
+  void dispatch(const Task &task);
   // Dispatch and move.
-  void dispatch(fp_t&& op);
+  void dispatch(Task &&task);
+  // Deferred tasks are not started until finishTasks is called, which
+  // runs them on the worker threads and waits for them and the
+  // dispatched tasks to finish.
+  // Defer and copy.
+  void deferTask(const Task &task);
+  // Defer and move.
+  void deferTask(Task &&task);
   void finishTasks();
+  // Call task with ranges of [0, count) claimed by the worker threads
+  // and wait for them to finish. A grain of zero sizes the ranges so
+  // each worker claims several of them to balance the load.
+  void parallelFor(size_t count,
+                   size_t grain,
+                   const RangeTask &task);
 
   // Deleted operations
   DispatchQueue(const DispatchQueue& rhs) = delete;
@@ -84,15 +127,49 @@ public:
   DispatchQueue& operator=(DispatchQueue&& rhs) = delete;
 
 private:
-  void dispatch_thread_handler(size_t i);
+  struct TaskDeque
+  {
+    std::mutex lock;
+    std::deque<Task> tasks;
+  };
+
+  void startThreads(size_t thread_count);
   void terminateThreads();
+  void workerLoop(size_t thread,
+                  uint64_t generation);
+  void runBatch(size_t thread);
+  void runBatches();
+  void queueTask(Task &&task);
+  bool runDispatched(size_t thread,
+                     uint64_t generation);
+  bool popTask(size_t thread,
+               // Return value.
+               Task &task);
+  bool stealTask(size_t thread,
+                 // Return value.
+                 Task &task);
+  void wakeWorkers();
+  void checkCaller(const char *func) const;
 
-  std::mutex lock_;
   std::vector<std::thread> threads_;
-  std::queue<fp_t> q_;
-  std::condition_variable cv_;
+  std::vector<Task> tasks_;
+  const RangeTask *range_task_{nullptr};
+  size_t range_count_{0};
+  size_t range_grain_{1};
+  // Next task or range index to claim.
+  std::atomic<size_t> next_index_{0};
+  // Incremented to start a batch or quit.
+  std::atomic<uint64_t> generation_{0};
+  DynamicLatch active_threads_latch_;
+  // Dispatched tasks indexed by worker thread.
+  std::vector<std::unique_ptr<TaskDeque>> deques_;
+  // Deque for the next task dispatched by the caller thread.
+  size_t next_deque_{0};
   DynamicLatch pending_task_count_latch_;
-  bool quit_ = false;
+  // Incremented when a task is dispatched, a batch starts or to quit.
+  std::atomic<uint64_t> wake_{0};
+  std::atomic<bool> quit_{false};
+  bool cpu_affinity_{false};
 };
 
 } // namespace sta
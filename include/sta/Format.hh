@@ -26,6 +26,7 @@
 
 #include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <string>
 #include <string_view>
 
@@ -70,6 +71,14 @@ void print(FILE *stream,
   std::fprintf(stream, "%s", s.c_str());
 }
 
+// Append to a string buffer.
+template <typename... Args>
+void print(std::string &buffer,
+           std::format_string<Args...> fmt,
+           Args &&...args) {
+  std::format_to(std::back_inserter(buffer), fmt, std::forward<Args>(args)...);
+}
+
 inline std::string vformat(std::string_view fmt,
                            std::format_args args) {
   return std::vformat(fmt, args);
@@ -129,6 +138,14 @@ void print(FILE *stream,
   std::fprintf(stream, "%s", s.c_str());
 }
 
+// Append to a string buffer.
+template <typename... Args>
+void print(std::string &buffer,
+           fmt::format_string<Args...> fmt,
+           Args &&...args) {
+  buffer += fmt::format(fmt, std::forward<Args>(args)...);
+}
+
 inline
 std::string vformat(std::string_view fmt,
                     fmt::format_args args) {
@@ -27,6 +27,10 @@
 #include <atomic>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "Delay.hh"
 #include "GraphClass.hh"
@@ -42,10 +46,13 @@ namespace sta {
 
 class MinMax;
 class Sdc;
+class PinWireEdges;
 
 using VertexTable = ObjectTable<Vertex>;
 using EdgeTable = ObjectTable<Edge>;
 using PinVertexMap = std::map<const Pin*, Vertex*>;
+using PinVertexSeq = std::vector<std::pair<const Pin*, Vertex*>>;
+using PinWireEdgesSeq = std::vector<PinWireEdges>;
 using VertexEdgeIterator = Iterator<Edge*>;
 using PeriodCheckAnnotations = std::map<const Pin*, float*, PinIdLess>;
 using EdgeId = ObjectId;
@@ -65,6 +72,7 @@ public:
 
   void delayCountChanged();
   size_t slewCount();
+  DcalcAPIndex apCount() const { return ap_count_; }
 
   // Vertex functions.
   // Bidirect pins have two vertices.
@@ -86,6 +94,9 @@ public:
   void deleteVertex(Vertex *vertex);
   bool hasFaninOne(Vertex *vertex) const;
   VertexId vertexCount() { return vertices_->size(); }
+  // Vertex ids are less than vertexIdBound().
+  VertexId vertexIdBound() const { return vertices_->idBound(); }
+  EdgeId edgeCount() const { return edges_->size(); }
 
   void visitFanouts(Vertex *vertex,
                     SearchPred *pred,
@@ -186,16 +197,62 @@ public:
   void setPeriodCheckAnnotation(const Pin *pin,
                                 DcalcAPIndex ap_index,
                                 float period);
+  // Periods indexed by ap_index; negative periods are not annotated.
+  const float *periodCheckAnnotations(const Pin *pin) const;
+  void removePeriodCheckAnnotations();
 
   // Remove all delay and slew annotations.
   void removeDelaySlewAnnotations();
   VertexSet &regClkVertices() { return reg_clk_vertices_; }
 
+  // Copy the vertex edge lists into compressed sparse row (CSR) arrays
+  // that are used by the vertex edge iterators until the graph is edited.
+  void freezeAdjacency();
+  // Freeze the adjacency if sta_graph_frozen_adjacency is enabled and
+  // the graph was edited since it was frozen.
+  void ensureFrozenAdjacency();
+  void deleteFrozenAdjacency();
+  bool adjacencyFrozen() const { return adjacency_frozen_; }
+
+  // Copy-on-write delays for what-if sessions.
+  // Save vertex slews and edge arc delays before they are first changed
+  // so they can be put back by restoreDelays.
+  void saveDelays();
+  bool savingDelays() const { return saving_delays_; }
+  // Restore the saved slews and arc delays and stop saving.
+  // Vertices with restored slews and the vertices of edges with
+  // restored delays are returned.
+  void restoreDelays(// Return value.
+                     VertexSeq &restored);
+  // Stop saving and discard the saved slews and arc delays.
+  void deleteSavedDelays();
+
   static constexpr int vertex_level_bits = 24;
   static constexpr int vertex_level_max = (1<<vertex_level_bits) - 1;
 
 protected:
   void makeVerticesAndEdges();
+  void makeGraphParallel();
+  size_t instVertexCount(const Instance *inst) const;
+  size_t instEdgeCount(const Instance *inst) const;
+  void makeInstVertices(const Instance *inst,
+                        VertexId vertex_id,
+                        // Return values.
+                        PinVertexSeq &bidirect_drvr_vertices,
+                        VertexSeq &reg_clk_vertices);
+  size_t findInstWireEdges(const Instance *inst,
+                           PinSet &visited_drvrs,
+                           // Return value.
+                           PinWireEdgesSeq &wire_edges) const;
+  void makeInstWireEdges(const PinWireEdgesSeq &wire_edges,
+                         EdgeId edge_id);
+  Edge *makeEdge(Vertex *from,
+                 Vertex *to,
+                 TimingArcSet *arc_set,
+                 EdgeId *reserved_id);
+  void makeWireEdge(const Pin *from_pin,
+                    const Pin *to_pin,
+                    EdgeId *edge_id);
   Vertex *makeVertex(Pin *pin,
                      bool is_bidirect_drvr,
                      bool is_reg_clk);
@@ -210,8 +267,8 @@ protected:
                              PinSet &visited_drvrs);
   void makePortInstanceEdges(const Instance *inst,
                              LibertyCell *cell,
-                             LibertyPort *from_to_port);
-  void removePeriodCheckAnnotations();
+                             LibertyPort *from_to_port,
+                             EdgeId *edge_id);
   void makeVertexSlews(Vertex *vertex);
   void deleteInEdge(Vertex *vertex,
                     Edge *edge);
@@ -221,6 +278,17 @@ protected:
   void initSlews(Vertex *vertex);
   void initArcDelays(Edge *edge);
   void removeDelayAnnotated(Edge *edge);
+  void initDelayAnnotated(Edge *edge);
+  void deleteDelayAnnotated(Edge *edge);
+  void deleteDelayAnnotations();
+  std::vector<bool> *arcDelayAnnotatedSeq(EdgeId edge_id) const;
+  static uintptr_t arcDelayAnnotateBit(size_t index);
+  void adjacencyChanged();
+  size_t delayFloatCount() const;
+  void saveSlews(Vertex *vertex);
+  void saveArcDelays(Edge *edge);
+  void deleteSavedDelays(Vertex *vertex);
+  void deleteSavedDelays(Edge *edge);
 
   VertexTable *vertices_{nullptr};
   EdgeTable *edges_{nullptr};
@@ -234,6 +302,25 @@ protected:
   // Register/latch clock vertices to search from.
   VertexSet reg_clk_vertices_;
   DcalcAPIndex ap_count_;
+  // Edge arc delay annotation bits indexed by edge id are kept out of
+  // the edges because they are only used by delay calculation.
+  // Edges with more arcs * analysis points than bits use a pointer
+  // to a bit vector.
+  std::vector<uintptr_t> arc_delay_annotated_bits_;
+  // Frozen edge arrays indexed by the offsets of each vertex id.
+  // The arrays are kept after an edit until the next freeze so
+  // iterators made before the edit are not left dangling.
+  bool adjacency_frozen_{false};
+  std::vector<EdgeId> frozen_in_offsets_;
+  std::vector<Edge*> frozen_in_edges_;
+  std::vector<EdgeId> frozen_out_offsets_;
+  std::vector<Edge*> frozen_out_edges_;
+  // Slews and arc delays saved by what-if sessions before they changed.
+  bool saving_delays_{false};
+  std::unordered_map<VertexId, std::vector<float>> saved_slews_;
+  std::unordered_map<EdgeId, std::vector<float>> saved_arc_delays_;
+  std::shared_mutex saved_slews_lock_;
+  std::shared_mutex saved_arc_delays_lock_;
 
   friend class Vertex;
   friend class VertexIterator;
@@ -312,15 +399,11 @@ protected:
   const float *slewsFloat() const { return slews_; }
   void setSlews(float *slews);
 
-  Pin *pin_;
+  // Fields used by the search and BFS traversals are first so they
+  // share a cache line.
+  Path *paths_;
   EdgeId in_edges_;             // Edges to this vertex.
   EdgeId out_edges_;            // Edges from this vertex.
-
-  // Delay calc
-  float *slews_;
-  // Search
-  Path *paths_;
-
   // These fields are written by multiple threads, so they
   // cannot share the same word as the following bit fields.
   uint32_t tag_group_index_;
@@ -344,8 +427,13 @@ protected:
   int level_:Graph::vertex_level_bits; // 24
   unsigned int slew_annotated_:slew_annotated_bits;  // 4
 
+  Pin *pin_;
+  // Delay calc
+  float *slews_;
+
 private:
   friend class Graph;
+  friend class Checkpoint;
   friend class Edge;
   friend class VertexInEdgeIterator;
   friend class VertexOutEdgeIterator;
@@ -399,26 +487,16 @@ protected:
             VertexId to,
             TimingArcSet *arc_set);
   void clear();
-  bool arcDelayAnnotated(const TimingArc *arc,
-                         DcalcAPIndex ap_index,
-                         DcalcAPIndex ap_count) const;
-  void setArcDelayAnnotated(const TimingArc *arc,
-                            DcalcAPIndex ap_index,
-                            DcalcAPIndex ap_count,
-                            bool annotated);
-  static uintptr_t arcDelayAnnotateBit(size_t index);
 
   TimingArcSet *arc_set_;
   float *arc_delays_;
-  union {
-    uintptr_t bits_;
-    std::vector<bool> *seq_;
-  } arc_delay_annotated_;
   VertexId from_;
   VertexId to_;
   EdgeId vertex_in_next_;               // Vertex in edges list.
   EdgeId vertex_out_next_;              // Vertex out edges doubly linked list.
+  // Only used to delete edges.
   EdgeId vertex_out_prev_;
+  // Arc delay annotations are in Graph::arc_delay_annotated_bits_.
   bool arc_delay_annotated_is_bits_:1;
   bool delay_annotation_is_incremental_:1;
   bool is_bidirect_inst_path_:1;
@@ -468,11 +546,16 @@ public:
                        const Graph *graph);
   VertexInEdgeIterator(VertexId vertex_id,
                        const Graph *graph);
-  bool hasNext() override { return (next_ != nullptr); }
+  bool hasNext() override;
   Edge *next() override;
 
 private:
-  Edge *next_;
+  void init(VertexId vertex_id);
+
+  Edge *next_{nullptr};
+  // Frozen adjacency edges.
+  Edge *const *frozen_next_{nullptr};
+  Edge *const *frozen_end_{nullptr};
   const Graph *graph_;
 };
 
@@ -481,11 +564,14 @@ class VertexOutEdgeIterator : public VertexEdgeIterator
 public:
   VertexOutEdgeIterator(Vertex *vertex,
                         const Graph *graph);
-  bool hasNext() override { return (next_ != nullptr); }
+  bool hasNext() override;
   Edge *next() override;
 
 private:
-  Edge *next_;
+  Edge *next_{nullptr};
+  // Frozen adjacency edges.
+  Edge *const *frozen_next_{nullptr};
+  Edge *const *frozen_end_{nullptr};
   const Graph *graph_;
 };
 
@@ -59,6 +59,8 @@ public:
   virtual void setObserver(DelayCalcObserver *observer);
   // Invalidate all delays/slews.
   virtual void delaysInvalid();
+  // Delays/slews were restored in the graph (read_checkpoint).
+  void delaysRestored();
   virtual void levelsChangedBefore();
   // Invalidate vertex and downstream delays/slews.
   virtual void delayInvalid(Vertex *vertex);
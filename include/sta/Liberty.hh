@@ -64,6 +64,7 @@ class TimingArcAttrs;
 class StaState;
 class Scene;
 class DriverWaveform;
+class LibertyDeferredCells;
 
 // Mode definition mode_value group (defined before ModeValueMap / ModeDef).
 class ModeValueDef
@@ -207,8 +208,14 @@ public:
   LibertyLibrary(std::string_view name,
                  std::string_view filename);
   ~LibertyLibrary() override;
+  ConcreteCell *findCell(std::string_view name) const override;
   LibertyCell *findLibertyCell(std::string_view name) const;
   LibertyCellSeq findLibertyCellsMatching(PatternMatch *pattern);
+  // Cells that have not been read yet by read_liberty -lazy.
+  // Deferred cells are read when they are found by name or pattern.
+  // LibertyCellIterator only reads them when read_deferred is true.
+  LibertyDeferredCells *deferredCells() const { return deferred_cells_; }
+  void setDeferredCells(LibertyDeferredCells *deferred_cells);
   // Liberty cells that are buffers.
   LibertyCellSeq *buffers();
   LibertyCellSeq *inverters();
@@ -398,6 +405,9 @@ protected:
   float degradeWireSlew(const TableModel *model,
                         float in_slew,
                         float wire_delay) const;
+  ConcreteCell *findDeferredCell(std::string_view name) const override;
+  void readDeferredCellsMatching(const PatternMatch *pattern) const override;
+  void readDeferredCells() const override;
 
   static constexpr float input_threshold_default_ = .5;
   static constexpr float output_threshold_default_ = .5;
@@ -451,20 +461,52 @@ protected:
   LibertyCellSeq *buffers_{nullptr};
   LibertyCellSeq *inverters_{nullptr};
   DriverWaveformMap driver_waveform_map_;
+  LibertyDeferredCells *deferred_cells_{nullptr};
 
 private:
   friend class LibertyCell;
   friend class LibertyCellIterator;
 };
 
+// Cell groups skipped by read_liberty -lazy that are read on demand.
+class LibertyDeferredCells
+{
+public:
+  virtual ~LibertyDeferredCells() = default;
+  virtual size_t cellCount() const = 0;
+  // Return nullptr if name is not a deferred cell.
+  virtual LibertyCell *readDeferredCell(std::string_view name) = 0;
+  virtual void readDeferredCellsMatching(const PatternMatch *pattern) = 0;
+  virtual void readDeferredCells() = 0;
+  // Scene maps are applied to deferred cells when they are read.
+  virtual void addSceneMap(Scene *scene,
+                           const MinMaxAll *min_max) = 0;
+  // Cells are read and found in libraries with deferred cells under
+  // one lock so lookups from parallel threads do not race with reads.
+  // It is shared by all libraries because reading a cell also reads
+  // it from the other lazy libraries.
+  static std::recursive_mutex &lock() { return lock_; }
+
+private:
+  static std::recursive_mutex lock_;
+};
+
 class LibertyCellIterator : public Iterator<LibertyCell*>
 {
 public:
-  LibertyCellIterator(const LibertyLibrary *library);
+  // With read_deferred false only the cells that have already been
+  // read by read_liberty -lazy are visited. Reading every deferred
+  // cell defeats -lazy, so only walks that need every cell of the
+  // library set read_deferred.
+  LibertyCellIterator(const LibertyLibrary *library,
+                      bool read_deferred = false);
   bool hasNext() override;
   LibertyCell *next() override;
 
 private:
+  static const ConcreteCellMap &cellMap(const LibertyLibrary *library,
+                                        bool read_deferred);
+
   ConcreteLibraryCellIterator iter_;
 };
 
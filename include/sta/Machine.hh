@@ -75,6 +75,11 @@ namespace sta {
 int
 processorCount();
 
+// Bind the calling thread to processor modulo the processor count.
+// Not supported on all platforms.
+void
+bindThreadProcessor(size_t processor);
+
 // Init elapsed (wall) time.
 void
 initElapsedTime();
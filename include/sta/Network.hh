@@ -40,6 +40,7 @@ namespace sta {
 class Report;
 class PatternMatch;
 class PinVisitor;
+class TableStore;
 
 using LibertyLibraryMap = std::map<std::string, LibertyLibrary*, std::less<>>;
 // Link network function returns top level instance.
@@ -133,6 +134,8 @@ public:
   // This corresponds to a link_path of '*'.
   virtual LibertyLibrary *defaultLibertyLibrary() const;
   void setDefaultLibertyLibrary(LibertyLibrary *library);
+  // Liberty tables shared by all libraries read into the network.
+  TableStore *tableStore();
   // Check liberty cells used by the network to make sure they exist
   // for all the defined scenes.
   void checkNetworkLibertyScenes();
@@ -492,6 +495,7 @@ protected:
   void clearNetDrvrPinMap();
 
   LibertyLibrary *default_liberty_{nullptr};
+  TableStore *table_store_{nullptr};
   char divider_{'/'};
   char escape_{'\\'};
   NetDrvrPinsMap net_drvr_pin_map_;
@@ -52,11 +52,16 @@ class ObjectTable
 public:
   ~ObjectTable();
   TYPE *make();
+  // Make count objects with consecutive ids in a table with no
+  // destroyed objects. Returns the id of the first object.
+  ObjectId make(size_t count);
   void destroy(TYPE *object);
   TYPE *pointer(ObjectId id) const;
   TYPE &ref(ObjectId id) const;
   ObjectId objectId(const TYPE *object);
   size_t size() const { return size_; }
+  // Object ids are less than idBound().
+  ObjectId idBound() const { return blocks_.size() << idx_bits; }
   void clear();
 
   // Objects are allocated in blocks of 128.
@@ -97,6 +102,23 @@ ObjectTable<TYPE>::make()
   return object;
 }
 
+template <class TYPE>
+ObjectId
+ObjectTable<TYPE>::make(size_t count)
+{
+  ObjectId first_id = object_id_null;
+  for (size_t i = 0; i < count; i++) {
+    TYPE *object = make();
+    ObjectId id = objectId(object);
+    if (i == 0)
+      first_id = id;
+    // Destroyed objects on the free list break the id sequence.
+    else if (id != first_id + i)
+      criticalError(227, "object table ids are not consecutive.");
+  }
+  return first_id;
+}
+
 template <class TYPE>
 void
 ObjectTable<TYPE>::freePush(TYPE *object,
@@ -192,7 +214,8 @@ public:
   TYPE *pointer(ObjectIdx idx) { return &objects_[idx]; }
 
 private:
-  TYPE objects_[ObjectTable<TYPE>::block_object_count];
+  // Blocks start on a cache line.
+  alignas(64) TYPE objects_[ObjectTable<TYPE>::block_object_count];
   BlockIdx block_idx_;
   ObjectTable<TYPE> *table_;
 };
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "Delay.hh"
 #include "GraphClass.hh"
 #include "MinMax.hh"
@@ -104,9 +106,13 @@ public:
   void setRequired(const Required &required);
   Slack slack(const StaState *sta) const;
   Slew slew(const StaState *sta) const;
+  // Previous paths are found with an index into the paths of the
+  // prev edge from vertex, or into the search enumerated paths, so
+  // vertex path arrays do not hold pointers to each other.
   // This takes the same time as prevPath and prevArc combined.
-  Path *prevPath() const;
-  void setPrevPath(Path *prev_path);
+  Path *prevPath(const StaState *sta) const;
+  void setPrevPath(Path *prev_path,
+                   const StaState *sta);
   void clearPrevPath(const StaState *sta);
   TimingArc *prevArc(const StaState *sta) const;
   Edge *prevEdge(const StaState *sta) const;
@@ -159,16 +165,48 @@ public:
                       const StaState *sta);
 
 protected:
-  Path *prev_path_;
+  bool hasPrevPath() const { return prev_path_idx_ != prev_path_idx_null; }
+  void setPrevPathIdx(Path *prev_path,
+                      const Edge *prev_edge,
+                      const StaState *sta);
+  void setPrevEnumPath(Path *prev_path,
+                       const StaState *sta);
+  static void checkPrevPathTag(const Path *prev_path,
+                               const Path *prev_path1,
+                               const StaState *sta);
+
+  static constexpr uint32_t prev_path_idx_null = UINT32_MAX;
+
   Arrival arrival_;
   Required required_;
   union {
     VertexId vertex_id_;
     EdgeId prev_edge_id_;
   };
+  // Index of the previous path in the prev edge from vertex paths,
+  // or in the search enumerated paths if prev_path_enum_ is set.
+  uint32_t prev_path_idx_;
   TagIndex tag_index_:tag_index_bit_count;
   bool is_enum_:1;
   unsigned prev_arc_idx_:2;
+  bool prev_path_enum_:1;
+};
+
+// Enumerated and generated clock source path copies.
+// The index of the copy in the search enumerated paths is kept with
+// the copy so next paths can find it without a search.
+class EnumPath : public Path
+{
+public:
+  using Path::Path;
+  uint32_t enumIndex() const { return enum_index_; }
+
+  static constexpr uint32_t enum_index_null = UINT32_MAX;
+
+private:
+  uint32_t enum_index_{enum_index_null};
+
+  friend class Search;
 };
 
 // Compare all path attributes (vertex, transition, tag, analysis point).
@@ -0,0 +1,135 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sta {
+
+class Report;
+
+// Compact binary path report written by write_path_report.
+//
+// The file is the magic "OSTAPRPT" and a uint32 version followed by a
+// stream of records so path ends are written as they are visited.
+// Each record starts with a uint8 tag.
+//   string:   uint32 length, characters
+//   path end: PathReportEnd, PathReportStage[stage_count]
+//   end:      end of the file
+// Names are interned in a string table. A string record defines the
+// next string index before the index is first used. Integers and
+// floats are in native byte order. Times are in seconds and
+// capacitances are in farads.
+
+enum class PathReportTag : uint8_t { string, path_end, end };
+
+struct PathReportStage
+{
+  // String table indices.
+  uint32_t pin;
+  uint32_t instance;
+  uint32_t cell;
+  uint32_t net;
+  float arrival;
+  float slew;
+  // Drivers only.
+  float capacitance;
+  float fanout;
+  uint8_t rise;
+  uint8_t is_driver;
+  uint8_t pad[2];
+};
+
+struct PathReportEnd
+{
+  // String table indices.
+  uint32_t type;
+  uint32_t path_group;
+  uint32_t startpoint;
+  uint32_t endpoint;
+  uint32_t source_clock;
+  uint32_t target_clock;
+  uint32_t stage_count;
+  // Check values are only valid when has_check is set.
+  float data_arrival;
+  float crpr;
+  float margin;
+  float required;
+  float slack;
+  uint8_t max;
+  uint8_t has_check;
+  uint8_t source_clock_rise;
+  uint8_t target_clock_rise;
+};
+
+static_assert(sizeof(PathReportStage) == 36);
+static_assert(sizeof(PathReportEnd) == 52);
+
+// Reader for files written by write_path_report.
+class PathReportReader
+{
+public:
+  PathReportReader(Report *report);
+  ~PathReportReader();
+  void open(std::string_view filename);
+  void close();
+  // Read the next path end and its stages.
+  // Return false at the end of the file.
+  bool next(PathReportEnd &end,
+            std::vector<PathReportStage> &stages);
+  // String table lookup; the empty string for no_string.
+  const std::string &string(uint32_t index) const;
+
+  static constexpr char magic[8] = {'O','S','T','A','P','R','P','T'};
+  static constexpr uint32_t version = 1;
+  static constexpr uint32_t no_string = UINT32_MAX;
+
+protected:
+  void readBytes(void *bytes,
+                 size_t size);
+  size_t remaining() const;
+  void corrupted();
+
+  Report *report_;
+  std::string filename_;
+  FILE *stream_;
+  long file_size_{0};
+  std::vector<std::string> strings_;
+  std::string empty_;
+};
+
+// Convert a binary path report to the json format of
+// report_checks -format json.
+void
+writePathReportJson(std::string_view filename,
+                    std::string_view json_filename,
+                    Report *report);
+
+} // namespace sta
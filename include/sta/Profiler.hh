@@ -0,0 +1,127 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace sta {
+
+// Hierarchical phase profiler.
+// ProfileScope timers around phases nest by thread and are written as
+// Chrome trace event json by writeTrace for viewing in a trace viewer.
+// DispatchQueue worker busy/idle time and ProfileLockGuard lock waits
+// are accumulated as counters.
+// Nothing is recorded until the profiler is enabled; disabled scopes
+// and locks only test a flag.
+class Profiler
+{
+public:
+  // Enabling clears recorded events and counters.
+  static void setEnabled(bool enabled);
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+  static void writeTrace(std::string_view filename);
+  // Microseconds since the profiler was enabled.
+  static double now();
+  // Name the calling thread in the trace.
+  static void setThreadName(std::string_view name);
+  // Names must be string literals.
+  static void recordEvent(const char *name,
+                          double begin,
+                          double end,
+                          const char *arg_name,
+                          int64_t arg);
+  static void recordThreadTime(size_t thread,
+                               double busy,
+                               double idle);
+  static void recordLockWait(const char *name,
+                             double wait);
+
+private:
+  static std::atomic<bool> enabled_;
+};
+
+// Time the enclosing scope when the profiler is enabled.
+// Name and arg_name must be string literals.
+class ProfileScope
+{
+public:
+  ProfileScope(const char *name) :
+    ProfileScope(name, nullptr, 0) {}
+  ProfileScope(const char *name,
+               const char *arg_name,
+               int64_t arg) :
+    name_(name),
+    arg_name_(arg_name),
+    arg_(arg),
+    begin_(Profiler::enabled() ? Profiler::now() : -1.0) {}
+  ~ProfileScope()
+  {
+    if (begin_ >= 0.0 && Profiler::enabled())
+      Profiler::recordEvent(name_, begin_, Profiler::now(), arg_name_, arg_);
+  }
+  ProfileScope(const ProfileScope &) = delete;
+  ProfileScope &operator=(const ProfileScope &) = delete;
+
+private:
+  const char *name_;
+  const char *arg_name_;
+  int64_t arg_;
+  double begin_;
+};
+
+// LockGuard that records the time spent waiting for a held lock
+// when the profiler is enabled. Name must be a string literal.
+class ProfileLockGuard
+{
+public:
+  ProfileLockGuard(std::mutex &mutex,
+                   const char *name) :
+    mutex_(mutex)
+  {
+    if (!mutex_.try_lock()) {
+      if (Profiler::enabled()) {
+        double begin = Profiler::now();
+        mutex_.lock();
+        Profiler::recordLockWait(name, Profiler::now() - begin);
+      }
+      else
+        mutex_.lock();
+    }
+  }
+  ~ProfileLockGuard() { mutex_.unlock(); }
+  ProfileLockGuard(const ProfileLockGuard &) = delete;
+  ProfileLockGuard &operator=(const ProfileLockGuard &) = delete;
+
+private:
+  std::mutex &mutex_;
+};
+
+} // namespace sta
@@ -187,6 +187,17 @@ public:
   // Redirect output to a string until redirectStringEnd is called.
   virtual void redirectStringBegin();
   virtual const char *redirectStringEnd();
+  // Copy output to a string until captureEnd is called.
+  // Output is printed or redirected as usual while it is captured.
+  void captureBegin();
+  std::string captureEnd();
+  // Append output printed by the calling thread to buffer until
+  // threadBufferEnd is called. Used to format reports on worker
+  // threads that are printed in order by the main thread.
+  static void threadBufferBegin(std::string *buffer);
+  static void threadBufferEnd();
+  // Print the lines in a thread buffer.
+  void printThreadBuffer(const std::string &buffer);
   virtual void setTclInterp(Tcl_Interp *) {}
 
   // Primitive to print output.
@@ -203,6 +214,8 @@ public:
 
 protected:
   // All sta print functions have an implicit return printed by this function.
+  // printLine and printString append to the thread buffer of the
+  // calling thread if it has one.
   virtual void printLine(const char *line,
                          size_t length);
   // Primitive to print output on the console.
@@ -216,10 +229,28 @@ protected:
   FILE *redirect_stream_{nullptr};
   bool redirect_to_string_{false};
   std::string redirect_string_;
+  bool capture_{false};
+  std::string capture_string_;
   static Report *default_;
+  static thread_local std::string *thread_buffer_;
   std::set<int> suppressed_msg_ids_;
 
   friend class Debug;
 };
 
+// Append the output printed by the calling thread to buffer while
+// the object is in scope.
+class ReportThreadBuffer
+{
+public:
+  ReportThreadBuffer(std::string *buffer)
+  {
+    Report::threadBufferBegin(buffer);
+  }
+  ~ReportThreadBuffer()
+  {
+    Report::threadBufferEnd();
+  }
+};
+
 }  // namespace sta
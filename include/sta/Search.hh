@@ -26,6 +26,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_set>
 
 #include "Delay.hh"
@@ -65,6 +66,9 @@ class Scene;
 
 using ClkInfoSet = std::set<const ClkInfo*, ClkInfoLess>;
 using TagSet = std::unordered_set<Tag*, TagHash, TagEqual>;
+using ExceptionStateSetSet = std::unordered_set<ExceptionStateSet*,
+                                                ExceptionStateSetHash,
+                                                ExceptionStateSetEqual>;
 using TagGroupSet = std::unordered_set<TagGroup*, TagGroupHash, TagGroupEqual>;
 using VertexSlackMap = std::map<Vertex*, Slack>;
 using VertexSlackMapSeq = std::vector<VertexSlackMap>;
@@ -126,6 +130,9 @@ public:
   void requiredInvalid(Vertex *vertex);
   void requiredInvalid(const Instance *inst);
   void requiredInvalid(const Pin *pin);
+  // Incremented when arrivals or requireds are invalidated by changes
+  // outside of the search, such as delays, constraints or netlist edits.
+  size_t timingChangeCount() const { return timing_change_count_; }
   // Vertex will be deleted.
   void deleteVertexBefore(Vertex *vertex);
   void deleteEdgeBefore(Edge *edge);
@@ -316,9 +323,14 @@ public:
                bool is_clk,
                InputDelay *input_delay,
                bool is_segment_start,
+               // Exception states from another tag, or a new set
+               // that is interned if own_states is true.
                ExceptionStateSet *states,
                bool own_states,
                TagSet *tag_cache);
+  // Return the shared copy of states, which is deleted if it is
+  // already interned. Empty state sets are interned as null.
+  ExceptionStateSet *internStates(ExceptionStateSet *states);
   void reportTags() const;
   void reportClkInfos() const;
   const ClkInfo *findClkInfo(Scene *scene,
@@ -404,7 +416,16 @@ public:
   void checkPrevPaths() const;
   void deletePaths(Vertex *vertex);
   void deleteTagGroup(TagGroup *group);
-  void saveEnumPath(Path *path);
+  // Enumerated and generated clock source path copies are referenced
+  // by index from their next paths. Enumerated paths are owned by the
+  // search. Generated clock source paths are owned by Genclks, which
+  // releases them before deleting them.
+  void saveEnumPath(EnumPath *path,
+                    bool search_owns = true);
+  void releaseEnumPath(const EnumPath *path);
+  Path *enumPath(uint32_t index) const { return enum_paths_[index]; }
+  // Returns EnumPath::enum_index_null if the path is not saved.
+  uint32_t enumPathIndex(const Path *path) const;
   bool isSrchRoot(Vertex *vertex,
                   const Mode *mode) const;
   DelaysWrtClks arrivalsWrtClks(Vertex *vertex,
@@ -420,6 +441,7 @@ protected:
   void deleteUnusedTagGroups();
   void seedInvalidArrivals();
   void seedArrivals();
+  void timingChanged();
   void findClockVertices(VertexSet &vertices);
   void seedClkDataArrival(const Pin *pin,
                           const RiseFall *rf,
@@ -598,6 +620,9 @@ protected:
   // Vertices with invalid arrival times to update and search from.
   VertexSet invalid_arrivals_;
   std::mutex invalid_arrivals_lock_;
+  std::atomic<size_t> timing_change_count_{0};
+  // Invalidations made by the search itself do not change timing.
+  bool searching_{false};
   BfsFwdIterator *arrival_iter_;
   ArrivalVisitor *arrival_visitor_;
 
@@ -633,6 +658,9 @@ protected:
   std::vector<Tag **> tags_prev_;
   TagIndex tag_next_{0};
   std::mutex tag_lock_;
+  // Tag exception states shared by tags.
+  ExceptionStateSetSet *exception_state_sets_;
+  std::shared_mutex exception_state_sets_lock_;
 
   // Capacity of tag_groups_.
   TagGroupIndex tag_group_capacity_;
@@ -660,7 +688,10 @@ protected:
   std::mutex filtered_arrivals_lock_;
 
   bool found_downstream_clk_pins_{false};
-  std::vector<Path*> enum_paths_;
+  std::vector<EnumPath*> enum_paths_;
+  std::vector<bool> enum_paths_owned_;
+  // Indices of released enum paths.
+  std::vector<uint32_t> enum_path_free_;
 
   VisitPathEnds *visit_path_ends_;
   GatedClk *gated_clk_;
@@ -43,6 +43,7 @@ namespace sta {
 class Search;
 class Scene;
 class Path;
+class EnumPath;
 class PathEnd;
 class PathGroup;
 class Tag;
@@ -51,6 +52,8 @@ class TagMatchLess;
 class TagLess;
 class TagHash;
 class TagEqual;
+class ExceptionStateSetHash;
+class ExceptionStateSetEqual;
 class TagGroup;
 class TagGroupHash;
 class TagGroupEqual;
@@ -70,6 +70,10 @@ class LibertyReader;
 class SearchPred;
 class Scene;
 class ClkSkews;
+class FilteredReportCache;
+class WhatIf;
+class NetlistEditBatch;
+class TimingArrays;
 class ReportField;
 class EquivCells;
 class StaSimObserver;
@@ -148,10 +152,12 @@ public:
   ModeSeq findModes(const std::string &mode_name) const;
   Sdc *cmdSdc() const;
 
+  // With lazy true cells are read when they are first referenced.
   virtual LibertyLibrary *readLiberty(std::string_view filename,
                                       Scene *scene,
                                       const MinMaxAll *min_max,
-                                      bool infer_latches);
+                                      bool infer_latches,
+                                      bool lazy = false);
   // tmp public
   void readLibertyAfter(LibertyLibrary *liberty,
                         Scene *scene,
@@ -1020,6 +1026,37 @@ public:
   void setReportPathNoSplit(bool no_split);
   void reportPathEnd(PathEnd *end);
   void reportPathEnds(PathEndSeq *ends);
+  // Write path ends to a binary path report (see PathReportBinary.hh).
+  void writePathReport(std::string_view filename,
+                       const PathEndSeq *ends);
+  // Find and report path ends with the findPathEnds arguments.
+  // When the report checks cache is enabled the report text is reused
+  // by later calls with the same from/thrus/to and options until the
+  // timing changes.
+  void reportChecks(ExceptionFrom *from,
+                    ExceptionThruSeq *thrus,
+                    ExceptionTo *to,
+                    bool unconstrained,
+                    const SceneSeq &scenes,
+                    const MinMaxAll *min_max,
+                    int group_path_count,
+                    int endpoint_path_count,
+                    bool unique_pins,
+                    bool unique_edges,
+                    float slack_min,
+                    float slack_max,
+                    bool sort_by_slack,
+                    StringSeq &group_names,
+                    bool setup,
+                    bool hold,
+                    bool recovery,
+                    bool removal,
+                    bool clk_gating_setup,
+                    bool clk_gating_hold);
+  // TCL variable sta_report_checks_cache_size.
+  // Number of reports saved by reportChecks. Zero disables the cache.
+  size_t reportChecksCacheSize() const;
+  void setReportChecksCacheSize(size_t size);
   ReportPath *reportPath() { return report_path_; }
   void reportPath(const Path *path);
   // For debugging.
@@ -1160,6 +1197,18 @@ public:
 
   void slacks(Vertex *vertex,
               Slack (&slacks)[RiseFall::index_count][MinMax::index_count]);
+  // Bulk queries of the worst slack, arrival, required and slew of
+  // each pin for each rise/fall and min/max over scenes.
+  // Arrivals and requireds are found for the whole design and the pins
+  // are visited in parallel.
+  void timingArrays(const PinSeq &pins,
+                    const SceneSeq &scenes,
+                    // Return value.
+                    TimingArrays &arrays);
+  // timingArrays for the pins in endpointPins().
+  void endpointTimingArrays(const SceneSeq &scenes,
+                            // Return value.
+                            TimingArrays &arrays);
   // Worst slack for an endpoint in a path group.
   Slack endpointSlack(const Pin *pin,
                       std::string_view path_group_name,
@@ -1296,6 +1345,24 @@ public:
   virtual void disconnectPin(Pin *pin);
   virtual void makePortPin(const char *port_name,
                            PortDirection *dir);
+  // Batch network edits. The vertex delay, arrival, required and level
+  // invalidations made by the edits are collected and made once for
+  // each vertex at endNetlistEdit. Batches may be nested.
+  void beginNetlistEdit();
+  void endNetlistEdit();
+  bool inNetlistEdit() const { return netlist_edit_depth_ > 0; }
+  // What-if sessions evaluate network edits (makeInstance, makeNet,
+  // replaceCell, connectPin, disconnectPin) and put the network and
+  // delays back when they are discarded. Graph slews and arc delays
+  // are saved when they are first changed in the session.
+  void beginWhatIf();
+  bool inWhatIf() const { return what_if_ != nullptr; }
+  // Keep the edits made since beginWhatIf.
+  void commitWhatIf();
+  // Undo the edits made since beginWhatIf and restore the delays.
+  // Only the arrivals and requireds downstream/upstream of the changed
+  // delays are found again.
+  void discardWhatIf();
   // Notify STA that the network has changed without using the network
   // editing API. For example, reading a netlist without using the
   // builtin network readers.
@@ -1363,6 +1430,11 @@ public:
   virtual void findDelays(Vertex *to_vertex);
   // Find arc delays and vertex slews thru to level.
   virtual void findDelays(Level level);
+  // Write arc delays and vertex slews to a binary checkpoint file.
+  void writeCheckpoint(std::string_view filename);
+  // Restore arc delays and vertex slews from a checkpoint written
+  // for the same design and scenes.
+  void readCheckpoint(std::string_view filename);
   // Percentage (0.0:1.0) change in delay that causes downstream
   // delays to be recomputed during incremental delay calculation.
   // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
@@ -1494,6 +1566,9 @@ public:
   // TCL variable sta_input_port_default_clock.
   bool useDefaultArrivalClock() const;
   void setUseDefaultArrivalClock(bool enable);
+  // TCL variable sta_graph_frozen_adjacency.
+  bool graphFrozenAdjacency() const;
+  void setGraphFrozenAdjacency(bool enable);
   ////////////////////////////////////////////////////////////////
 
   Properties &properties() { return properties_; }
@@ -1531,8 +1606,19 @@ protected:
   LibertyLibrary *readLibertyFile(std::string_view filename,
                                   Scene *scene,
                                   const MinMaxAll *min_max,
-                                  bool infer_latches);
+                                  bool infer_latches,
+                                  bool lazy);
   void delayCalcPreamble();
+  // Changing the analysis point count discards the delays saved by a
+  // what-if session, so it is an error in a session.
+  void checkWhatIfDelayCount();
+  // Vertex invalidations from network edits that are deferred
+  // in a netlist edit batch.
+  void editDelayInvalid(Vertex *vertex);
+  void editArrivalInvalid(Vertex *vertex);
+  void editRequiredInvalid(Vertex *vertex);
+  void editEndpointInvalid(Vertex *vertex);
+  void editRelevelizeFrom(Vertex *vertex);
   void delaysInvalidFrom(const Port *port);
   void delaysInvalidFromFanin(const Port *port);
   void deleteEdge(Edge *edge);
@@ -1658,6 +1744,10 @@ protected:
   CheckMaxSkews *check_max_skews_{nullptr};
   ClkSkews *clk_skews_{nullptr};
   ReportPath *report_path_{nullptr};
+  FilteredReportCache *report_checks_cache_{nullptr};
+  WhatIf *what_if_{nullptr};
+  NetlistEditBatch *netlist_edit_batch_{nullptr};
+  int netlist_edit_depth_{0};
   Power *power_{nullptr};
   Tcl_Interp *tcl_interp_{nullptr};
   bool update_genclks_{false};
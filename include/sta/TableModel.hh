@@ -26,8 +26,10 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "LibertyClass.hh"
@@ -222,6 +224,9 @@ public:
   const FloatSeq &values() const { return values_; }
   float min() const;
   float max() const;
+  size_t hash() const;
+  bool equal(const TableAxis *axis) const;
+  size_t byteSize() const;
 
 private:
   TableAxisVariable variable_;
@@ -303,6 +308,11 @@ public:
   // Order 2 and 3: pointer to value table (nullptr otherwise).
   FloatTable *values3();
   const FloatTable *values3() const;
+  // Hash and equality of values and axes.
+  // Axes are compared by pointer so they should be interned first.
+  size_t hash() const;
+  bool equal(const Table *table) const;
+  size_t byteSize() const;
 
 private:
   void clear();
@@ -433,6 +443,46 @@ protected:
   std::unique_ptr<TableModel> skewness_;
 };
 
+// Hash-consed table axes and tables shared across liberty libraries.
+// Libraries characterized at different corners typically repeat the
+// same index and value tables, so identical data is kept once.
+// Interned tables and axes are immutable.
+// The store only holds weak references; tables are freed with the
+// last model that references them.
+class TableStore
+{
+public:
+  TableStore();
+  // Return an existing axis/table equal to the argument or the argument.
+  TableAxisPtr internAxis(TableAxisPtr axis);
+  TablePtr internTable(TablePtr table);
+  // Tables interned and tables that were found in the store.
+  size_t tableCount();
+  size_t tableSharedCount();
+  void report(Report *report);
+
+private:
+  template <class PTR>
+  PTR intern(PTR obj,
+             std::unordered_multimap<size_t, std::weak_ptr<typename PTR::element_type>> &objs,
+             size_t &intern_count,
+             size_t &shared_count,
+             size_t &bytes_saved);
+  template <class T>
+  void removeExpired(std::unordered_multimap<size_t, std::weak_ptr<T>> &objs);
+
+  std::unordered_multimap<size_t, std::weak_ptr<TableAxis>> axes_;
+  std::unordered_multimap<size_t, std::weak_ptr<Table>> tables_;
+  size_t axis_count_;
+  size_t axis_shared_count_;
+  size_t axis_bytes_saved_;
+  size_t table_count_;
+  size_t table_shared_count_;
+  size_t table_bytes_saved_;
+  size_t expire_check_count_;
+  std::mutex lock_;
+};
+
 ////////////////////////////////////////////////////////////////
 
 class ReceiverModel
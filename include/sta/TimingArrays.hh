@@ -0,0 +1,91 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "MinMax.hh"
+#include "NetworkClass.hh"
+#include "Transition.hh"
+
+namespace sta {
+
+// Worst slack, arrival, required and slew of a list of pins in
+// contiguous arrays for bulk queries (Sta::timingArrays).
+// Each array has value_count values for each pin ordered by
+//  rise/fall index * MinMax::index_count + min/max index.
+class TimingArrays
+{
+public:
+  static constexpr size_t value_count = RiseFall::index_count
+    * MinMax::index_count;
+
+  // Size the arrays for the pins and set the values to the
+  // min/max initial values (slack and slew INF, arrival -INF/INF).
+  void init(const PinSeq &pins);
+  size_t pinCount() const { return pins_.size(); }
+  const PinSeq &pins() const { return pins_; }
+  static size_t index(size_t pin_index,
+                      const RiseFall *rf,
+                      const MinMax *min_max)
+  {
+    return pin_index * value_count
+      + rf->index() * MinMax::index_count + min_max->index();
+  }
+  const std::vector<float> &slacks() const { return slacks_; }
+  const std::vector<float> &arrivals() const { return arrivals_; }
+  const std::vector<float> &requireds() const { return requireds_; }
+  const std::vector<float> &slews() const { return slews_; }
+  std::vector<float> &slacks() { return slacks_; }
+  std::vector<float> &arrivals() { return arrivals_; }
+  std::vector<float> &requireds() { return requireds_; }
+  std::vector<float> &slews() { return slews_; }
+  // Write the pin names and arrays to a binary file.
+  //  char magic[8] "OSTATARR"
+  //  uint32 version
+  //  uint32 value_count
+  //  uint64 pin_count
+  //  pin_count * { uint32 name_length, char name[name_length] }
+  //  float slacks[pin_count * value_count]
+  //  float arrivals[pin_count * value_count]
+  //  float requireds[pin_count * value_count]
+  //  float slews[pin_count * value_count]
+  void write(std::string_view filename,
+             const Network *network) const;
+
+  static constexpr uint32_t version = 1;
+
+private:
+  PinSeq pins_;
+  std::vector<float> slacks_;
+  std::vector<float> arrivals_;
+  std::vector<float> requireds_;
+  std::vector<float> slews_;
+};
+
+} // namespace sta
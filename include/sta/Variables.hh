@@ -73,6 +73,10 @@ public:
   // TCL variable sta_input_port_default_clock.
   bool useDefaultArrivalClock() { return use_default_arrival_clock_; }
   void setUseDefaultArrivalClock(bool enable);
+  // TCL variable sta_graph_frozen_adjacency.
+  // Use compressed vertex edge arrays until the graph is edited.
+  bool graphFrozenAdjacency() const { return graph_frozen_adjacency_; }
+  void setGraphFrozenAdjacency(bool enable);
   bool pocvEnabled() const;
   PocvMode pocvMode() const { return pocv_mode_; }
   void setPocvMode(PocvMode mode);
@@ -92,6 +96,7 @@ private:
   bool dynamic_loop_breaking_{false};
   bool propagate_all_clks_{false};
   bool use_default_arrival_clock_{false};
+  bool graph_frozen_adjacency_{false};
   PocvMode pocv_mode_{PocvMode::scalar};
   float pocv_quantile_{3.0};
 };
@@ -44,6 +44,9 @@
 #define gzclose fclose
 #define gzgets(stream,s,size) fgets(s,size,stream)
 #define gzprintf fprintf
+#define gzread(stream,buf,len) fread(buf,1,len,stream)
+#define gzwrite(stream,buf,len) fwrite(buf,1,len,stream)
+#define gzseek fseek
 #define Z_NULL nullptr
 
 namespace gzstream {
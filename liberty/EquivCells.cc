@@ -126,7 +126,8 @@ void
 EquivCells::findEquivCells(const LibertyLibrary *library,
                            LibertyCellHashMap &hash_matches)
 {
-  LibertyCellIterator cell_iter(library);
+  // Equivalents are found among all of the library cells.
+  LibertyCellIterator cell_iter(library, true);
   while (cell_iter.hasNext()) {
     LibertyCell *cell = cell_iter.next();
     if (!cell->dontUse()) {
@@ -164,7 +165,7 @@ EquivCells::mapEquivCells(const LibertyLibrary *library,
                           LibertyCellHashMap &hash_matches)
 {
   
-  LibertyCellIterator cell_iter(library);
+  LibertyCellIterator cell_iter(library, true);
   while (cell_iter.hasNext()) {
     LibertyCell *cell = cell_iter.next();
     if (!cell->dontUse()) {
@@ -95,6 +95,18 @@ LibertyLibrary::~LibertyLibrary()
 
   delete buffers_;
   delete inverters_;
+  delete deferred_cells_;
+}
+
+ConcreteCell *
+LibertyLibrary::findCell(std::string_view name) const
+{
+  if (deferred_cells_) {
+    std::scoped_lock lock(LibertyDeferredCells::lock());
+    return ConcreteLibrary::findCell(name);
+  }
+  else
+    return ConcreteLibrary::findCell(name);
 }
 
 LibertyCell *
@@ -103,9 +115,42 @@ LibertyLibrary::findLibertyCell(std::string_view name) const
   return static_cast<LibertyCell*>(findCell(name));
 }
 
+std::recursive_mutex LibertyDeferredCells::lock_;
+
+void
+LibertyLibrary::setDeferredCells(LibertyDeferredCells *deferred_cells)
+{
+  delete deferred_cells_;
+  deferred_cells_ = deferred_cells;
+}
+
+ConcreteCell *
+LibertyLibrary::findDeferredCell(std::string_view name) const
+{
+  if (deferred_cells_)
+    return deferred_cells_->readDeferredCell(name);
+  else
+    return nullptr;
+}
+
+void
+LibertyLibrary::readDeferredCellsMatching(const PatternMatch *pattern) const
+{
+  if (deferred_cells_)
+    deferred_cells_->readDeferredCellsMatching(pattern);
+}
+
+void
+LibertyLibrary::readDeferredCells() const
+{
+  if (deferred_cells_)
+    deferred_cells_->readDeferredCells();
+}
+
 LibertyCellSeq
 LibertyLibrary::findLibertyCellsMatching(PatternMatch *pattern)
 {
+  readDeferredCellsMatching(pattern);
   LibertyCellSeq matches;
   LibertyCellIterator cell_iter(this);
   while (cell_iter.hasNext()) {
@@ -121,7 +166,7 @@ LibertyLibrary::inverters()
 {
   if (inverters_ == nullptr) {
     inverters_ = new LibertyCellSeq;
-    LibertyCellIterator cell_iter(this);
+    LibertyCellIterator cell_iter(this, true);
     while (cell_iter.hasNext()) {
       LibertyCell *cell = cell_iter.next();
       if (!cell->dontUse()
@@ -137,7 +182,7 @@ LibertyLibrary::buffers()
 {
   if (buffers_ == nullptr) {
     buffers_ = new LibertyCellSeq;
-    LibertyCellIterator cell_iter(this);
+    LibertyCellIterator cell_iter(this, true);
     while (cell_iter.hasNext()) {
       LibertyCell *cell = cell_iter.next();
       if (!cell->dontUse()
@@ -712,6 +757,7 @@ LibertyLibrary::makeSceneMap(LibertyLibrary *lib,
                              Network *network,
                              Report *report)
 {
+  // Deferred cells are mapped when they are read.
   LibertyCellIterator cell_iter(lib);
   while (cell_iter.hasNext()) {
     LibertyCell *cell = cell_iter.next();
@@ -719,6 +765,8 @@ LibertyLibrary::makeSceneMap(LibertyLibrary *lib,
     if (link_cell)
       makeSceneMap(link_cell, cell, scene, min_max, report);
   }
+  if (lib->deferred_cells_)
+    lib->deferred_cells_->addSceneMap(scene, min_max);
 }
 
 // Map a cell linked in the network to the corresponding liberty cell
@@ -891,9 +939,21 @@ LibertyLibrary::makeDriverWaveform(std::string_view name,
 
 ////////////////////////////////////////////////////////////////
 
-LibertyCellIterator::LibertyCellIterator(const LibertyLibrary *library) :
-  iter_(library->cell_map_)
+LibertyCellIterator::LibertyCellIterator(const LibertyLibrary *library,
+                                         bool read_deferred) :
+  iter_(cellMap(library, read_deferred))
+{
+}
+
+// Deferred cells are read before the iterator is positioned
+// at the first cell.
+const ConcreteCellMap &
+LibertyCellIterator::cellMap(const LibertyLibrary *library,
+                             bool read_deferred)
 {
+  if (read_deferred)
+    library->readDeferredCells();
+  return library->cell_map_;
 }
 
 bool
@@ -29,6 +29,7 @@
 #include "EquivCells.hh"
 #include "LibertyWriter.hh"
 #include "Sta.hh"
+#include "TableModel.hh"
 
 using namespace sta;
 
@@ -117,13 +118,34 @@ bool
 read_liberty_cmd(char *filename,
                  Scene *scene,
                  const MinMaxAll *min_max,
-                 bool infer_latches)
+                 bool infer_latches,
+                 bool lazy)
 {
   Sta *sta = Sta::sta();
-  LibertyLibrary *lib = sta->readLiberty(filename, scene, min_max, infer_latches);
+  LibertyLibrary *lib = sta->readLiberty(filename, scene, min_max, infer_latches,
+                                         lazy);
   return (lib != nullptr);
 }
 
+void
+report_liberty_table_sharing_cmd()
+{
+  Sta *sta = Sta::sta();
+  sta->network()->tableStore()->report(sta->report());
+}
+
+size_t
+liberty_table_count()
+{
+  return Sta::sta()->network()->tableStore()->tableCount();
+}
+
+size_t
+liberty_table_shared_count()
+{
+  return Sta::sta()->network()->tableStore()->tableSharedCount();
+}
+
 void
 write_liberty_cmd(LibertyLibrary *library,
                   char *filename)
@@ -227,6 +249,14 @@ find_liberty_cell(const char *name)
   return self->findLibertyCell(name);
 }
 
+// Cells skipped by read_liberty -lazy that have not been read.
+int
+deferred_cell_count()
+{
+  LibertyDeferredCells *deferred_cells = self->deferredCells();
+  return deferred_cells ? deferred_cells->cellCount() : 0;
+}
+
 LibertyCellSeq
 find_liberty_cells_matching(const char *pattern,
                             bool regexp,
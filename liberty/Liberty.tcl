@@ -27,7 +27,7 @@
 namespace eval sta {
 
 define_cmd_args "read_liberty" \
-  {[-corner corner] [-min] [-max] [-infer_latches] filename} \
+  {[-corner corner] [-min] [-max] [-infer_latches] [-lazy] filename} \
   -help {The `read_liberty` command reads a Liberty format library file. The first library that is read sets the units used by SDC/Tcl commands and reporting. The include_file attribute is supported.
 
 Some Liberty libraries do not include latch groups for cells that describe transparent latches. In that situation the `-infer_latches` command flag can be used to infer the latches. The timing arcs required for a latch to be inferred should look like the following:
@@ -63,6 +63,8 @@ cell (inferred_latch) {
 
 In this example a positive level-sensitive latch is inferred.
 
+The `-lazy` flag skips the cell groups when the file is read and reads each cell when it is first referenced by the netlist or found by `get_lib_cells`. Equivalent cell, buffer and inverter lists and `write_liberty` read all of the cells. Cells that are never referenced are not read. Compressed files are uncompressed up to each cell that is read.
+
 Files compressed with gzip are automatically uncompressed.} \
   -arg_help {
     -corner {Deprecated. Use `define_scene` to assign Liberty libraries to a scene.}
@@ -70,18 +72,20 @@ Files compressed with gzip are automatically uncompressed.} \
     -max {Use the library for max-delay (setup) analysis.}
     filename {The Liberty file name to read.}
     -infer_latches {Infer latches from timing arcs when the Liberty file has no latch groups.}
+    -lazy {Read cells when they are first referenced.}
   }
 
 proc_redirect read_liberty {
   parse_key_args "read_liberty" args keys {-corner} \
-    flags {-min -max -infer_latches}
+    flags {-min -max -infer_latches -lazy}
   check_argc_eq1 "read_liberty" $args
 
   set filename [file nativename [lindex $args 0]]
   set corner [parse_scene keys]
   set min_max [parse_min_max_all_flags flags]
   set infer_latches [info exists flags(-infer_latches)]
-  read_liberty_cmd $filename $corner $min_max $infer_latches
+  set lazy [info exists flags(-lazy)]
+  read_liberty_cmd $filename $corner $min_max $infer_latches $lazy
 }
 
 # for regression testing
@@ -95,6 +99,16 @@ proc write_liberty { args } {
 
 ################################################################
 
+define_cmd_args "report_liberty_table_sharing" {[> filename] [>> filename]} \
+  -help {Report liberty table axes and tables shared across libraries.}
+
+proc_redirect report_liberty_table_sharing {
+  check_argc_eq0 "report_liberty_table_sharing" $args
+  report_liberty_table_sharing_cmd
+}
+
+################################################################
+
 define_cmd_args "report_lib_cell" {cell_name [> filename] [>> filename]} \
   -help {Describe the liberty library cell cell_name.} \
   -arg_help {
@@ -37,8 +37,8 @@ int \
 sta::LibertyScanner::lex(sta::LibertyParse::semantic_type *yylval, \
                          sta::LibertyParse::location_type *loc)
 
-// update location on matching
-#define YY_USER_ACTION loc->step(); loc->columns(yyleng);
+// update location and stream offset on matching
+#define YY_USER_ACTION loc->step(); loc->columns(yyleng); offset_ += yyleng;
 
 typedef sta::LibertyParse::token token;
 
@@ -55,6 +55,7 @@ typedef sta::LibertyParse::token token;
 
 %x comment
 %x qstring
+%x skip_group
 
 DIGIT [0-9]
 ALPHA [a-zA-Z]
@@ -87,6 +88,7 @@ EOL \r?\n
 {FLOAT}{TOKEN_END} {
 	/* Push back the TOKEN_END character. */
 	yyless(yyleng - 1);
+	offset_--;
 	yylval->emplace<float>(strtof(yytext, nullptr));
 	return token::FLOAT;
 	}
@@ -94,7 +96,10 @@ EOL \r?\n
 {ALPHA}({ALPHA}|_|{DIGIT})*{TOKEN_END} {
 	/* Push back the TOKEN_END character. */
 	yyless(yyleng - 1);
-	yylval->emplace<std::string>(yytext, yyleng);
+	offset_--;
+	const std::string *keyword = reader_->internSymbol(std::string_view(yytext, yyleng));
+	float_list_attr_ = isFloatListAttr(*keyword);
+	yylval->emplace<const std::string *>(keyword);
 	return token::KEYWORD;
 	}
 
@@ -107,6 +112,7 @@ EOL \r?\n
 {TOKEN}{TOKEN_END} {
 	/* Push back the TOKEN_END character. */
 	yyless(yyleng - 1);
+	offset_--;
 	yylval->emplace<std::string>(yytext, yyleng);
 	return token::STRING;
 	}
@@ -134,6 +140,12 @@ EOL \r?\n
 
 <qstring>\" {
 	BEGIN(INITIAL);
+	/* Parse table values and indices directly to floats. */
+	sta::FloatSeq floats;
+	if (float_list_attr_ && parseFloatList(token_, floats)) {
+	  yylval->emplace<sta::FloatSeq>(std::move(floats));
+	  return token::FLOAT_LIST;
+	}
 	yylval->emplace<std::string>(token_);
 	return token::STRING;
 	}
@@ -171,6 +183,37 @@ EOL \r?\n
 	/* Send out of bound characters to parser. */
 .	{ return (int) yytext[0]; }
 
+	/* Skip a group body without parsing it (see skipGroupBody). */
+<skip_group>[^{}"/\r\ni]+	{}
+
+<skip_group>"include_file"	{ skip_include_ = true; }
+
+<skip_group>\"([^"\\]|\\(.|\n))*\" { skipLines(loc); }
+
+<skip_group>"/*"([^*]|"*"+[^*/])*"*"+"/" { skipLines(loc); }
+
+<skip_group>{EOL}	{ loc->lines(); loc->step(); }
+
+<skip_group>"{"	{ skip_depth_++; }
+
+<skip_group>"}"	{
+	if (skip_depth_ == 0) {
+	  skipGroupEnd();
+	  BEGIN(INITIAL);
+	  return '}';
+	}
+	else
+	  skip_depth_--;
+	}
+
+<skip_group>.	{}
+
+<skip_group><<EOF>> {
+	error("unterminated group");
+	BEGIN(INITIAL);
+	yyterminate();
+	}
+
 <<EOF>> { if (stream_prev_)
             fileEnd();
           else
@@ -178,3 +221,14 @@ EOL \r?\n
         }
 
 %%
+
+// Defined here to use the flex start condition.
+void
+sta::LibertyScanner::skipGroupBody()
+{
+  skipped_body_ = LibertyGroupBody(filename_, offset_, offset_, yylineno,
+                                   false);
+  skip_depth_ = 0;
+  skip_include_ = false;
+  BEGIN(skip_group);
+}
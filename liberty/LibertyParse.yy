@@ -61,11 +61,14 @@ sta::LibertyParse::error(const location_type &loc,
 %parse-param { LibertyParser *reader }
 %define api.parser.class {LibertyParse}
 %define api.value.type variant
+%initial-action { @$.initialize(nullptr, scanner->lineno()); }
 
 %expect 0
 
-%token <std::string> STRING KEYWORD
+%token <std::string> STRING
+%token <const std::string *> KEYWORD
 %token <float> FLOAT
+%token <sta::FloatSeq> FLOAT_LIST
 
 %left '+' '-' '|'
 %left '*' '/' '&'
@@ -87,22 +90,19 @@ file:
 	;
 
 group:
-	KEYWORD '(' ')' '{'
-	{ reader->groupBegin(std::move($1), nullptr, loc_line(@1)); }
-	'}' semi_opt
-	{ $$ = reader->groupEnd(); }
-|	KEYWORD '(' ')' '{'
-	{ reader->groupBegin(std::move($1), nullptr, loc_line(@1)); }
-	statements '}' semi_opt
+	group_begin '}' semi_opt
 	{ $$ = reader->groupEnd(); }
-|	KEYWORD '(' attr_values ')' '{'
-	{ reader->groupBegin(std::move($1), $3, loc_line(@1)); }
-	'}' semi_opt
+|	group_begin statements '}' semi_opt
 	{ $$ = reader->groupEnd(); }
+	;
+
+/* The group begin action is a default reduction so the scanner has not
+   read past the '{' when groupBegin is called. */
+group_begin:
+	KEYWORD '(' ')' '{'
+	{ reader->groupBegin($1, nullptr, loc_line(@1)); }
 |	KEYWORD '(' attr_values ')' '{'
-	{ reader->groupBegin(std::move($1), $3, loc_line(@1)); }
-	statements '}' semi_opt
-	{ $$ = reader->groupEnd(); }
+	{ reader->groupBegin($1, $3, loc_line(@1)); }
 	;
 
 statements:
@@ -119,14 +119,14 @@ statement:
 
 simple_attr:
 	KEYWORD ':' attr_value semi_opt
-	{ $$ = reader->makeSimpleAttr(std::move($1), $3, loc_line(@1)); }
+	{ $$ = reader->makeSimpleAttr($1, $3, loc_line(@1)); }
 	;
 
 complex_attr:
 	KEYWORD '(' ')' semi_opt
-	{ $$ = reader->makeComplexAttr(std::move($1), nullptr, loc_line(@1)); }
+	{ $$ = reader->makeComplexAttr($1, nullptr, loc_line(@1)); }
 |	KEYWORD '(' attr_values ')' semi_opt
-	{ $$ = reader->makeComplexAttr(std::move($1), $3, loc_line(@1)); }
+	{ $$ = reader->makeComplexAttr($1, $3, loc_line(@1)); }
 	;
 
 attr_values:
@@ -153,12 +153,14 @@ string:
 	STRING
 	{ $$ = $1; }
 |	KEYWORD
-	{ $$ = $1; }
+	{ $$ = *$1; }
 	;
 
 attr_value:
 	expr
 	{ $$ = reader->makeAttrValueString(std::move($1)); }
+|	FLOAT_LIST
+	{ $$ = reader->makeAttrValueFloatList(std::move($1)); }
 	;
 
 expr:
@@ -24,15 +24,19 @@
 
 #include "LibertyParser.hh"
 
+#include <cctype>
+#include <cstdlib>
 #include <cstring>
 #include <istream>
 #include <regex>
+#include <sstream>
 #include <string>
 #include <string_view>
 #include <utility>
 
 #include "ContainerHelpers.hh"
 #include "Error.hh"
+#include "Hash.hh"
 #include "LibertyParse.hh"
 #include "LibertyScanner.hh"
 #include "Report.hh"
@@ -51,6 +55,7 @@ parseLibertyFile(std::string_view filename,
   if (stream.is_open()) {
     LibertyParser reader(filename, library_visitor, report);
     LibertyScanner scanner(&stream, filename, &reader, report);
+    reader.setScanner(&scanner);
     LibertyParse parser(&scanner, &reader);
     parser.parse();
   }
@@ -58,6 +63,22 @@ parseLibertyFile(std::string_view filename,
     throw FileNotReadable(filename);
 }
 
+void
+parseLibertyGroup(const std::string &group_text,
+                  std::string_view filename,
+                  int line,
+                  LibertyGroupVisitor *group_visitor,
+                  Report *report)
+{
+  std::istringstream stream(group_text);
+  LibertyParser reader(filename, group_visitor, report);
+  LibertyScanner scanner(&stream, filename, &reader, report);
+  scanner.setLineno(line);
+  reader.setScanner(&scanner);
+  LibertyParse parser(&scanner, &reader);
+  parser.parse();
+}
+
 LibertyParser::LibertyParser(std::string_view filename,
                              LibertyGroupVisitor *library_visitor,
                              Report *report) :
@@ -73,6 +94,18 @@ LibertyParser::setFilename(std::string_view filename)
   filename_ = filename;
 }
 
+void
+LibertyParser::setScanner(LibertyScanner *scanner)
+{
+  scanner_ = scanner;
+}
+
+const std::string *
+LibertyParser::internSymbol(std::string_view symbol)
+{
+  return symbols_.intern(symbol);
+}
+
 LibertyDefine *
 LibertyParser::makeDefine(const LibertyAttrValueSeq *values,
                           int line)
@@ -131,11 +164,11 @@ LibertyParser::groupType(const std::string &group_type_name)
 }
 
 void
-LibertyParser::groupBegin(std::string &&type,
+LibertyParser::groupBegin(const std::string *type,
                           LibertyAttrValueSeq *params,
                           int line)
 {
-  LibertyGroup *group = new LibertyGroup(std::move(type),
+  LibertyGroup *group = new LibertyGroup(type,
                                          params
                                          ? std::move(*params)
                                          : LibertyAttrValueSeq(),
@@ -144,6 +177,10 @@ LibertyParser::groupBegin(std::string &&type,
   LibertyGroup *parent_group = group_stack_.empty() ? nullptr : group_stack_.back();
   group_visitor_->begin(group, parent_group);
   group_stack_.push_back(group);
+  if (group_visitor_->deferGroup(group, parent_group)) {
+    deferred_group_ = group;
+    scanner_->skipGroupBody();
+  }
 }
 
 LibertyGroup *
@@ -154,7 +191,12 @@ LibertyParser::groupEnd()
   LibertyGroup *parent = group_stack_.empty() ? nullptr : group_stack_.back();
   if (parent)
     parent->addSubgroup(group);
-  group_visitor_->end(group, parent);
+  if (group == deferred_group_) {
+    deferred_group_ = nullptr;
+    group_visitor_->endDeferred(group, parent, scanner_->skippedGroupBody());
+  }
+  else
+    group_visitor_->end(group, parent);
   return group;
 }
 
@@ -171,11 +213,11 @@ LibertyParser::deleteGroups()
 }
 
 LibertySimpleAttr *
-LibertyParser::makeSimpleAttr(std::string &&name,
-                              const LibertyAttrValue *value,
+LibertyParser::makeSimpleAttr(const std::string *name,
+                              LibertyAttrValue *value,
                               int line)
 {
-  LibertySimpleAttr *attr = new LibertySimpleAttr(std::move(name), *value, line);
+  LibertySimpleAttr *attr = new LibertySimpleAttr(name, std::move(*value), line);
   delete value;
   LibertyGroup *group = this->group();
   group->addAttr(attr);
@@ -184,18 +226,18 @@ LibertyParser::makeSimpleAttr(std::string &&name,
 }
 
 LibertyComplexAttr *
-LibertyParser::makeComplexAttr(std::string &&name,
+LibertyParser::makeComplexAttr(const std::string *name,
                                const LibertyAttrValueSeq *values,
                                int line)
 {
   // Defines have the same syntax as complex attributes.
   // Detect and convert them.
-  if (name == "define") {
+  if (*name == "define") {
     makeDefine(values, line);
     return nullptr;  // Define is not a complex attr; already added to group
   }
   else {
-    LibertyComplexAttr *attr = new LibertyComplexAttr(std::move(name), *values, line);
+    LibertyComplexAttr *attr = new LibertyComplexAttr(name, *values, line);
     delete values;
     LibertyGroup *group = this->group();
     group->addAttr(attr);
@@ -228,6 +270,29 @@ LibertyParser::makeAttrValueFloat(float value)
   return new LibertyAttrValue(value);
 }
 
+LibertyAttrValue *
+LibertyParser::makeAttrValueFloatList(FloatSeq &&values)
+{
+  return new LibertyAttrValue(std::move(values));
+}
+
+////////////////////////////////////////////////////////////////
+
+size_t
+LibertySymbolHash::operator()(std::string_view symbol) const
+{
+  return hashString(symbol);
+}
+
+const std::string *
+LibertySymbolTable::intern(std::string_view symbol)
+{
+  auto itr = symbols_.find(symbol);
+  if (itr == symbols_.end())
+    itr = symbols_.emplace(symbol).first;
+  return &*itr;
+}
+
 ////////////////////////////////////////////////////////////////
 
 LibertyScanner::LibertyScanner(std::istream *stream,
@@ -242,6 +307,60 @@ LibertyScanner::LibertyScanner(std::istream *stream,
 {
 }
 
+void
+LibertyScanner::skipGroupEnd()
+{
+  // offset_ includes the closing '}'.
+  skipped_body_ = LibertyGroupBody(skipped_body_.filename(),
+                                   skipped_body_.begin(), offset_ - 1,
+                                   skipped_body_.line(), skip_include_);
+}
+
+void
+LibertyScanner::skipLines(LibertyParse::location_type *loc)
+{
+  for (int i = 0; i < yyleng; i++) {
+    if (yytext[i] == '\n')
+      loc->lines();
+  }
+  loc->step();
+}
+
+bool
+LibertyScanner::isFloatListAttr(std::string_view name)
+{
+  return name == "values"
+    || (name.starts_with("index_") && name.size() > 6);
+}
+
+bool
+LibertyScanner::parseFloatList(const std::string &str,
+                               // Return value.
+                               FloatSeq &values)
+{
+  values.clear();
+  const char *ptr = str.c_str();
+  while (true) {
+    while (*ptr == ' ' || *ptr == ',' || *ptr == '\t'
+           || *ptr == '{' || *ptr == '}')
+      ptr++;
+    if (*ptr == '\0')
+      break;
+    // Only decimal floats; leave anything else to the string path.
+    if (!(isdigit(static_cast<unsigned char>(*ptr)) || *ptr == '-' || *ptr == '+' || *ptr == '.'))
+      return false;
+    char *end;
+    float value = strtof(ptr, &end);
+    if (end == ptr
+        || !(*end == '\0' || *end == ' ' || *end == ','
+             || *end == '\t' || *end == '{' || *end == '}'))
+      return false;
+    values.push_back(value);
+    ptr = end;
+  }
+  return values.size() > 1;
+}
+
 bool
 LibertyScanner::includeBegin()
 {
@@ -259,6 +378,8 @@ LibertyScanner::includeBegin()
 
         filename_prev_ = filename_;
         stream_prev_ = stream_;
+        offset_prev_ = offset_;
+        offset_ = 0;
 
         filename_ = filename;
         reader_->setFilename(filename);
@@ -284,6 +405,7 @@ LibertyScanner::fileEnd()
     delete stream_;
   stream_ = stream_prev_;
   filename_ = filename_prev_;
+  offset_ = offset_prev_;
   stream_prev_ = nullptr;
 
   yypop_buffer_state();
@@ -297,10 +419,10 @@ LibertyScanner::error(const char *msg)
 
 ////////////////////////////////////////////////////////////////
 
-LibertyGroup::LibertyGroup(std::string type,
+LibertyGroup::LibertyGroup(const std::string *type,
                            LibertyAttrValueSeq params,
                            int line) :
-  type_(std::move(type)),
+  type_(type),
   params_(std::move(params)),
   line_(line)
 {
@@ -526,10 +648,10 @@ LibertyGroup::findAttrInt(std::string_view attr_name,
 
 ////////////////////////////////////////////////////////////////
 
-LibertySimpleAttr::LibertySimpleAttr(std::string &&name,
+LibertySimpleAttr::LibertySimpleAttr(const std::string *name,
                                      LibertyAttrValue value,
                                      int line) :
-  name_(std::move(name)),
+  name_(name),
   line_(line),
   value_(std::move(value))
 {
@@ -537,10 +659,10 @@ LibertySimpleAttr::LibertySimpleAttr(std::string &&name,
 
 ////////////////////////////////////////////////////////////////
 
-LibertyComplexAttr::LibertyComplexAttr(std::string &&name,
+LibertyComplexAttr::LibertyComplexAttr(const std::string *name,
                                        LibertyAttrValueSeq values,
                                        int line) :
-  name_(std::move(name)),
+  name_(name),
   values_(std::move(values)),
   line_(line)
 {
@@ -569,10 +691,16 @@ LibertyAttrValue::LibertyAttrValue(float value) :
 {
 }
 
+LibertyAttrValue::LibertyAttrValue(FloatSeq &&values) :
+  float_value_(values.empty() ? 0.0F : values[0]),
+  float_list_(std::move(values))
+{
+}
+
 bool
 LibertyAttrValue::isFloat() const
 {
-  return string_value_.empty();
+  return string_value_.empty() && float_list_.empty();
 }
 
 bool
@@ -592,6 +720,21 @@ LibertyAttrValue::floatValue() const
 
 ////////////////////////////////////////////////////////////////
 
+LibertyGroupBody::LibertyGroupBody(std::string_view filename,
+                                   size_t begin,
+                                   size_t end,
+                                   int line,
+                                   bool has_include) :
+  filename_(filename),
+  begin_(begin),
+  end_(end),
+  line_(line),
+  has_include_(has_include)
+{
+}
+
+////////////////////////////////////////////////////////////////
+
 LibertyDefine::LibertyDefine(std::string &&name,
                              LibertyGroupType group_type,
                              LibertyAttrType value_type,
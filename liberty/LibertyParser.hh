@@ -25,9 +25,11 @@
 #pragma once
 
 #include <functional>
+#include <string>
 #include <string_view>
 #include <vector>
 #include <map>
+#include <unordered_set>
 #include <utility>
 
 #include "Zlib.hh"
@@ -45,11 +47,13 @@ class LibertyAttrValue;
 class LibertyVariable;
 class LibertyScanner;
 
+using FloatSeq = std::vector<float>;
 using LibertyGroupSeq = std::vector<LibertyGroup*>;
-using LibertySubGroupMap = std::map<std::string, LibertyGroupSeq, std::less<>>;
-using LibertySimpleAttrMap = std::map<std::string, LibertySimpleAttr*, std::less<>>;
+// Group and attribute name keys are interned by the parser.
+using LibertySubGroupMap = std::map<std::string_view, LibertyGroupSeq>;
+using LibertySimpleAttrMap = std::map<std::string_view, LibertySimpleAttr*>;
 using LibertyComplexAttrSeq = std::vector<LibertyComplexAttr*>;
-using LibertyComplexAttrMap = std::map<std::string, LibertyComplexAttrSeq, std::less<>>;
+using LibertyComplexAttrMap = std::map<std::string_view, LibertyComplexAttrSeq>;
 using LibertyDefineMap = std::map<std::string, LibertyDefine*, std::less<>>;
 using LibertyAttrValueSeq = std::vector<LibertyAttrValue*>;
 using LibertyVariableSeq = std::vector<LibertyVariable*>;
@@ -61,6 +65,53 @@ enum class LibertyAttrType { attr_string, attr_int, attr_double,
 
 enum class LibertyGroupType { library, cell, pin, timing, unknown };
 
+class LibertySymbolHash
+{
+public:
+  using is_transparent = void;
+  size_t operator()(std::string_view symbol) const;
+};
+
+// Interned group and attribute names.
+// Names are looked up without copying the scanner token and the set
+// owns one copy of each name for all groups and attributes.
+class LibertySymbolTable
+{
+public:
+  const std::string *intern(std::string_view symbol);
+
+private:
+  std::unordered_set<std::string, LibertySymbolHash, std::equal_to<>> symbols_;
+};
+
+// Location of a group body in a liberty file that was skipped by the
+// scanner so it can be parsed later.
+class LibertyGroupBody
+{
+public:
+  LibertyGroupBody() = default;
+  LibertyGroupBody(std::string_view filename,
+                   size_t begin,
+                   size_t end,
+                   int line,
+                   bool has_include);
+  const std::string &filename() const { return filename_; }
+  // Byte offsets of the body text between the group braces.
+  size_t begin() const { return begin_; }
+  size_t end() const { return end_; }
+  // Line of the group '{'.
+  int line() const { return line_; }
+  // The body has an include_file.
+  bool hasInclude() const { return has_include_; }
+
+private:
+  std::string filename_;
+  size_t begin_{0};
+  size_t end_{0};
+  int line_{0};
+  bool has_include_{false};
+};
+
 class LibertyParser
 {
 public:
@@ -74,46 +125,61 @@ public:
                            int line);
   LibertyAttrType attrValueType(const std::string &value_type_name);
   LibertyGroupType groupType(const std::string &group_type_name);
-  void groupBegin(std::string &&type,
+  const std::string *internSymbol(std::string_view symbol);
+  void groupBegin(const std::string *type,
                   LibertyAttrValueSeq *params,
                   int line);
   LibertyGroup *groupEnd();
   LibertyGroup *group();
   void deleteGroups();
-  LibertySimpleAttr *makeSimpleAttr(std::string &&name,
-                                    const LibertyAttrValue *value,
+  LibertySimpleAttr *makeSimpleAttr(const std::string *name,
+                                    LibertyAttrValue *value,
                                     int line);
-  LibertyComplexAttr *makeComplexAttr(std::string &&name,
+  LibertyComplexAttr *makeComplexAttr(const std::string *name,
                                      const LibertyAttrValueSeq *values,
                                      int line);
   LibertyAttrValue *makeAttrValueString(std::string &&value);
   LibertyAttrValue *makeAttrValueFloat(float value);
+  LibertyAttrValue *makeAttrValueFloatList(FloatSeq &&values);
   LibertyVariable *makeVariable(std::string &&var,
                                 float value,
                                 int line);
+  void setScanner(LibertyScanner *scanner);
 
 private:
   std::string filename_;
   LibertyGroupVisitor *group_visitor_;
   Report *report_;
+  LibertyScanner *scanner_{nullptr};
+  // Groups and attributes reference names in the symbol table so
+  // they must be deleted before the parser.
+  LibertySymbolTable symbols_;
   LibertyGroupSeq group_stack_;
+  // Group with a body skipped by the scanner.
+  const LibertyGroup *deferred_group_{nullptr};
 };
 
-// Attribute values are a string or float.
+// Attribute values are a string, float or list of floats.
 class LibertyAttrValue
 {
 public:
   LibertyAttrValue(float value);
   LibertyAttrValue(std::string &&value);
+  // Quoted list of floats parsed by the scanner.
+  //  "1.0, 2.0, 3.0"
+  LibertyAttrValue(FloatSeq &&values);
   bool isString() const;
   bool isFloat() const;
+  bool isFloatList() const { return !float_list_.empty(); }
   std::pair<float, bool> floatValue() const;
   const std::string &stringValue() const { return string_value_; }
   std::string &stringValue() { return string_value_; }
+  const FloatSeq &floatList() const { return float_list_; }
 
 private:
   float float_value_;
   std::string string_value_;
+  FloatSeq float_list_;
 };
 
 // Groups are a type keyword with a set of parameters and statements
@@ -122,14 +188,14 @@ private:
 class LibertyGroup
 {
 public:
-  LibertyGroup(std::string type,
+  LibertyGroup(const std::string *type,
                LibertyAttrValueSeq params,
                int line);
   ~LibertyGroup();
   void clear();
   bool empty() const;
   bool oneGroupOnly() const;
-  const std::string &type() const { return type_; }
+  const std::string &type() const { return *type_; }
   const LibertyAttrValueSeq &params() const { return params_; }
   bool hasFirstParam() const;
   const std::string &firstParam() const;
@@ -163,7 +229,7 @@ public:
   void addVariable(LibertyVariable *var);
 
 protected:
-  std::string type_;
+  const std::string *type_;
   LibertyAttrValueSeq params_;
   int line_;
 
@@ -189,16 +255,16 @@ public:
 class LibertySimpleAttr
 {
 public:
-  LibertySimpleAttr(std::string &&name,
+  LibertySimpleAttr(const std::string *name,
                     LibertyAttrValue value,
                     int line);
-  const std::string &name() const { return name_; }
+  const std::string &name() const { return *name_; }
   const LibertyAttrValue &value() const { return value_; };
   const std::string &stringValue() const { return value_.stringValue(); }
   int line() const { return line_; }
 
 private:
-  std::string name_;
+  const std::string *name_;
   int line_;
   LibertyAttrValue value_;
 };
@@ -208,17 +274,17 @@ private:
 class LibertyComplexAttr
 {
 public:
-  LibertyComplexAttr(std::string &&name,
+  LibertyComplexAttr(const std::string *name,
                      LibertyAttrValueSeq values,
                      int line);
   ~LibertyComplexAttr();
-  const std::string &name() const { return name_; }
+  const std::string &name() const { return *name_; }
   const LibertyAttrValue *firstValue() const;
   const LibertyAttrValueSeq &values() const { return values_; }
   int line() const { return line_; }
 
 private:
-  std::string name_;
+  const std::string *name_;
   LibertyAttrValueSeq values_;
   int line_;
 };
@@ -275,10 +341,25 @@ public:
   virtual void visitAttr(const LibertySimpleAttr *attr) = 0;
   virtual void visitAttr(const LibertyComplexAttr *attr) = 0;
   virtual void visitVariable(LibertyVariable *variable) = 0;
+  // Return true to skip parsing the body of a group.
+  // endDeferred is called instead of end with the location of the body.
+  virtual bool deferGroup(const LibertyGroup *,
+                          const LibertyGroup *) { return false; }
+  virtual void endDeferred(const LibertyGroup *,
+                           LibertyGroup *,
+                           const LibertyGroupBody &) {}
 };
 
 void
 parseLibertyFile(std::string_view filename,
                  LibertyGroupVisitor *library_visitor,
                  Report *report);
+// Parse a group that was skipped by parseLibertyFile.
+// line is the line number of the group in filename.
+void
+parseLibertyGroup(const std::string &group_text,
+                  std::string_view filename,
+                  int line,
+                  LibertyGroupVisitor *group_visitor,
+                  Report *report);
 } // namespace sta
@@ -28,6 +28,7 @@
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <string_view>
@@ -52,6 +53,7 @@
 #include "Network.hh"
 #include "NetworkClass.hh"
 #include "ParseBus.hh"
+#include "PatternMatch.hh"
 #include "PortDirection.hh"
 #include "Sequential.hh"
 #include "StringUtil.hh"
@@ -69,21 +71,32 @@ namespace sta {
 static void
 scaleFloats(FloatSeq &floats,
             float scale);
+static FloatSeq
+scaleFloatList(const FloatSeq &floats,
+               float scale);
 
 LibertyLibrary *
 readLibertyFile(std::string_view filename,
                 bool infer_latches,
+                bool lazy,
                 Network *network)
 {
-  LibertyReader reader(filename, infer_latches, network);
-  return reader.readLibertyFile(filename);
+  auto reader = std::make_unique<LibertyReader>(filename, infer_latches,
+                                                lazy, network);
+  LibertyLibrary *library = reader->readLibertyFile(filename);
+  // The library owns the reader to read the deferred cells.
+  if (library && reader->cellCount() > 0)
+    library->setDeferredCells(reader.release());
+  return library;
 }
 
 LibertyReader::LibertyReader(std::string_view filename,
                              bool infer_latches,
+                             bool lazy,
                              Network *network) :
   filename_(filename),
   infer_latches_(infer_latches),
+  lazy_(lazy),
   report_(network->report()),
   debug_(network->debug()),
   network_(network),
@@ -92,6 +105,12 @@ LibertyReader::LibertyReader(std::string_view filename,
   defineVisitors();
 }
 
+LibertyReader::~LibertyReader()
+{
+  if (deferred_stream_)
+    gzclose(deferred_stream_);
+}
+
 LibertyLibrary *
 LibertyReader::readLibertyFile(std::string_view filename)
 {
@@ -169,6 +188,7 @@ LibertyReader::endLibrary(const LibertyGroup *library_group,
 
 ////////////////////////////////////////////////////////////////
 
+// library_group is null for deferred cells.
 void
 LibertyReader::endCell(const LibertyGroup *cell_group,
                        LibertyGroup *library_group)
@@ -177,7 +197,7 @@ LibertyReader::endCell(const LibertyGroup *cell_group,
   // Normally they are all defined by the first cell, but there
   // are libraries that define table templates and bus tyupes
   // between cells.
-  if (!library_group->oneGroupOnly())
+  if (library_group && !library_group->oneGroupOnly())
     readLibraryAttributes(library_group);
 
   if (cell_group->hasFirstParam()) {
@@ -191,7 +211,165 @@ LibertyReader::endCell(const LibertyGroup *cell_group,
 
   // Delete the cell group and preceding library attributes
   // and groups so they are not revisited and reduce memory peak.
+  if (library_group)
+    library_group->clear();
+  else
+    delete cell_group;
+}
+
+////////////////////////////////////////////////////////////////
+
+bool
+LibertyReader::deferGroup(const LibertyGroup *group,
+                          const LibertyGroup *parent_group)
+{
+  return lazy_
+    && parent_group
+    && parent_group->type() == "library"
+    && group->type() == "cell"
+    && group->hasFirstParam();
+}
+
+void
+LibertyReader::endDeferred(const LibertyGroup *cell_group,
+                           LibertyGroup *library_group,
+                           const LibertyGroupBody &body)
+{
+  if (!library_group->oneGroupOnly())
+    readLibraryAttributes(library_group);
+  // Copy the name because the cell group is deleted by clear.
+  std::string name = cell_group->firstParam();
+  debugPrint(debug_, "liberty", 2, "defer cell {}", name);
+  deferred_cells_.insert_or_assign(name, body);
   library_group->clear();
+  // Include files are relative to the working directory when the
+  // library is read, so cells that include files are read now.
+  if (body.hasInclude())
+    readDeferredCell(name);
+}
+
+LibertyCell *
+LibertyReader::readDeferredCell(std::string_view name)
+{
+  std::scoped_lock lock(LibertyDeferredCells::lock());
+  auto itr = deferred_cells_.find(name);
+  if (itr == deferred_cells_.end())
+    return nullptr;
+  std::string cell_name = itr->first;
+  LibertyGroupBody body = itr->second;
+  // Remove the cell before reading it so lookups while it is read
+  // do not recurse.
+  deferred_cells_.erase(itr);
+
+  debugPrint(debug_, "liberty", 1, "read deferred cell {}", cell_name);
+  std::string group_text = "cell(\"" + cell_name + "\") {";
+  if (readGroupBody(body, group_text)) {
+    group_text += '}';
+    parseLibertyGroup(group_text, body.filename(), body.line(), this, report_);
+  }
+  else
+    report_->fileWarn(1102, body.filename(), body.line(),
+                      "cannot read cell {}.", cell_name);
+
+  LibertyCell *cell = library_->findLibertyCell(cell_name);
+  if (cell) {
+    for (auto [scene, min_max] : scene_maps_) {
+      LibertyCell *link_cell = network_->findLibertyCell(cell_name);
+      if (link_cell)
+        LibertyLibrary::makeSceneMap(link_cell, cell, scene, min_max, report_);
+    }
+    readOtherLibraryCells(cell_name);
+  }
+  return cell;
+}
+
+// Read the cell in other libraries that defer it so the scene cells
+// of the link cell are complete.
+void
+LibertyReader::readOtherLibraryCells(std::string_view cell_name)
+{
+  LibertyLibraryIterator *lib_iter = network_->libertyLibraryIterator();
+  while (lib_iter->hasNext()) {
+    LibertyLibrary *lib = lib_iter->next();
+    if (lib != library_)
+      lib->findLibertyCell(cell_name);
+  }
+  delete lib_iter;
+}
+
+bool
+LibertyReader::readGroupBody(const LibertyGroupBody &body,
+                             // Return value.
+                             std::string &text)
+{
+  if (deferred_stream_ == nullptr
+      || body.filename() != deferred_stream_filename_) {
+    if (deferred_stream_)
+      gzclose(deferred_stream_);
+    // Uncompressed files seek directly to the body. Compressed files
+    // are decompressed from the current position (or the beginning
+    // for bodies before it).
+    deferred_stream_ = gzopen(body.filename().c_str(), "rb");
+    deferred_stream_filename_ = body.filename();
+  }
+  if (deferred_stream_
+      && gzseek(deferred_stream_, body.begin(), SEEK_SET) != -1) {
+    size_t length = body.end() - body.begin();
+    size_t text_length = text.size();
+    text.resize(text_length + length);
+    int read_length = gzread(deferred_stream_, text.data() + text_length, length);
+    return read_length == static_cast<int>(length);
+  }
+  return false;
+}
+
+void
+LibertyReader::readDeferredCellsMatching(const PatternMatch *pattern)
+{
+  std::scoped_lock lock(LibertyDeferredCells::lock());
+  StringSeq cell_names;
+  for (const auto &[cell_name, body] : deferred_cells_) {
+    if (pattern->match(cell_name))
+      cell_names.push_back(cell_name);
+  }
+  for (const std::string &cell_name : cell_names)
+    readDeferredCell(cell_name);
+}
+
+void
+LibertyReader::readDeferredCells()
+{
+  std::scoped_lock lock(LibertyDeferredCells::lock());
+  StringSeq cell_names;
+  for (const auto &[cell_name, body] : deferred_cells_)
+    cell_names.push_back(cell_name);
+  for (const std::string &cell_name : cell_names)
+    readDeferredCell(cell_name);
+}
+
+void
+LibertyReader::addSceneMap(Scene *scene,
+                           const MinMaxAll *min_max)
+{
+  std::scoped_lock lock(LibertyDeferredCells::lock());
+  scene_maps_.emplace_back(scene, min_max);
+  // Read deferred cells that are already referenced in other libraries.
+  StringSeq cell_names;
+  LibertyLibraryIterator *lib_iter = network_->libertyLibraryIterator();
+  while (lib_iter->hasNext()) {
+    LibertyLibrary *lib = lib_iter->next();
+    if (lib != library_) {
+      LibertyCellIterator cell_iter(lib);
+      while (cell_iter.hasNext()) {
+        LibertyCell *cell = cell_iter.next();
+        if (deferred_cells_.contains(cell->name()))
+          cell_names.push_back(cell->name());
+      }
+    }
+  }
+  delete lib_iter;
+  for (const std::string &cell_name : cell_names)
+    readDeferredCell(cell_name);
 }
 
 void
@@ -610,7 +788,8 @@ LibertyReader::makeTableTemplateAxis(const LibertyGroup *template_group,
       const Units *units = library_->units();
       float scale = tableVariableUnit(axis_var, units)->scale();
       scaleFloats(axis_values, scale);
-      return make_shared<TableAxis>(axis_var, std::move(axis_values));
+      TableAxisPtr axis = make_shared<TableAxis>(axis_var, std::move(axis_values));
+      return network_->tableStore()->internAxis(std::move(axis));
     }
   }
   return nullptr;
@@ -1004,6 +1183,9 @@ LibertyReader::readScaledCell(const LibertyGroup *scaled_cell_group)
   if (scaled_cell_group->hasFirstParam()) {
     const std::string &name = scaled_cell_group->firstParam();
     LibertyCell *owner = library_->findLibertyCell(name);
+    // The library does not own the reader while the file is read.
+    if (owner == nullptr)
+      owner = readDeferredCell(name);
     if (owner) {
       if (scaled_cell_group->hasSecondParam()) {
         const std::string &op_cond_name = scaled_cell_group->secondParam();
@@ -2452,11 +2634,10 @@ LibertyReader::readOutputWaveforms(const LibertyGroup *timing_group,
             // Convert 1x1xN Table (order 3) to 1D Table.
             float slew = slew_axis->axisValue(0);
             float cap = cap_axis->axisValue(0);
-            TablePtr table_ptr = table->table();
-            FloatTable *values3 = table_ptr->values3();
-            FloatSeq row = std::move((*values3)[0]);
-            values3->erase(values3->begin());
-            Table *table1 = new Table(std::move(row), table->table()->axis3ptr());
+            // Copy the row because the table values may be shared.
+            const Table *table3 = table->table().get();
+            FloatSeq row = (*table3->values3())[0];
+            Table *table1 = new Table(std::move(row), table3->axis3ptr());
             output_currents.emplace_back(slew, cap, table1, ref_time);
           }
           else
@@ -2568,28 +2749,31 @@ LibertyReader::readTableModel(const LibertyGroup *table_group,
     TableAxisPtr axis1 = makeTableAxis(table_group, "index_1", tbl_template->axis1ptr());
     TableAxisPtr axis2 = makeTableAxis(table_group, "index_2", tbl_template->axis2ptr());
     TableAxisPtr axis3 = makeTableAxis(table_group, "index_3", tbl_template->axis3ptr());
+    TablePtr table;
     if (axis1 && axis2 && axis3) {
       // 3D table
       FloatTable float_table = makeFloatTable(values_attr, table_group,
                                               axis1->size() * axis2->size(),
                                               axis3->size(), scale);
-      return make_shared<Table>(std::move(float_table), axis1, axis2, axis3);
+      table = make_shared<Table>(std::move(float_table), axis1, axis2, axis3);
     }
     else if (axis1 && axis2) {
       FloatTable float_table = makeFloatTable(values_attr, table_group,
                                               axis1->size(), axis2->size(), scale);
-      return make_shared<Table>(std::move(float_table), axis1, axis2);
+      table = make_shared<Table>(std::move(float_table), axis1, axis2);
     }
     else if (axis1) {
-      FloatTable table = makeFloatTable(values_attr, table_group, 1,
-                                        axis1->size(), scale);
-      return make_shared<Table>(std::move(table[0]), axis1);
+      FloatTable float_table = makeFloatTable(values_attr, table_group, 1,
+                                              axis1->size(), scale);
+      table = make_shared<Table>(std::move(float_table[0]), axis1);
     }
     else if (axis1 == nullptr && axis2 == nullptr && axis3 == nullptr) {
-      FloatTable table = makeFloatTable(values_attr, table_group, 1, 1, scale);
-      float value = table[0][0];
-      return std::make_shared<Table>(value);
+      FloatTable float_table = makeFloatTable(values_attr, table_group, 1, 1, scale);
+      float value = float_table[0][0];
+      table = std::make_shared<Table>(value);
     }
+    // Tables are shared across libraries so they must not be modified.
+    return network_->tableStore()->internTable(std::move(table));
   }
   else
     warn(1257, table_group, "{} is missing values.", table_group->type());
@@ -2620,7 +2804,8 @@ LibertyReader::makeTableAxis(const LibertyGroup *table_group,
       const Units *units = library_->units();
       float scale = tableVariableUnit(axis_var, units)->scale();
       scaleFloats(axis_values, scale);
-      return make_shared<TableAxis>(axis_var, std::move(axis_values));
+      TableAxisPtr axis = make_shared<TableAxis>(axis_var, std::move(axis_values));
+      return network_->tableStore()->internAxis(std::move(axis));
     }
   }
   return template_axis;
@@ -3238,7 +3423,9 @@ LibertyReader::makeFloatTable(const LibertyComplexAttr *values_attr,
   for (const LibertyAttrValue *value : values_attr->values()) {
     FloatSeq row;
     row.reserve(cols);
-    if (value->isString())
+    if (value->isFloatList())
+      row = scaleFloatList(value->floatList(), scale);
+    else if (value->isString())
       row = parseFloatList(value->stringValue(), scale, values_attr->line());
     else if (value->isFloat()) {
       auto [entry, valid] = value->floatValue();
@@ -3348,6 +3535,18 @@ LibertyReader::parseFloatList(const std::string &float_list,
   return values;
 }
 
+// Float lists parsed by the scanner are not scaled.
+static FloatSeq
+scaleFloatList(const FloatSeq &floats,
+               float scale)
+{
+  FloatSeq values;
+  values.reserve(floats.size());
+  for (float value : floats)
+    values.push_back(value * scale);
+  return values;
+}
+
 FloatSeq
 LibertyReader::readFloatSeq(const LibertyComplexAttr *attr,
                             float scale)
@@ -3356,7 +3555,9 @@ LibertyReader::readFloatSeq(const LibertyComplexAttr *attr,
   const LibertyAttrValueSeq &attr_values = attr->values();
   if (attr_values.size() == 1) {
     LibertyAttrValue *value = attr_values[0];
-    if (value->isString())
+    if (value->isFloatList())
+      values = scaleFloatList(value->floatList(), scale);
+    else if (value->isString())
       values = parseFloatList(value->stringValue(), scale, attr->line());
     else {
       auto [entry, valid] = value->floatValue();
@@ -3366,7 +3567,11 @@ LibertyReader::readFloatSeq(const LibertyComplexAttr *attr,
   }
   else if (attr_values.size() > 1) {
     for (LibertyAttrValue *value : attr_values) {
-      if (value->isString()) {
+      if (value->isFloatList()) {
+        for (float entry : value->floatList())
+          values.push_back(entry * scale);
+      }
+      else if (value->isString()) {
         FloatSeq parsed = parseFloatList(value->stringValue(), scale, attr->line());
         values.insert(values.end(), parsed.begin(), parsed.end());
       }
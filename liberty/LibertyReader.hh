@@ -31,9 +31,11 @@ namespace sta {
 class Network;
 class LibertyLibrary;
 
+// With lazy true cells are read when they are first found by name.
 LibertyLibrary *
 readLibertyFile(std::string_view filename,
                 bool infer_latches,
+                bool lazy,
                 Network *network);
 
 } // namespace sta
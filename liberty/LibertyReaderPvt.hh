@@ -33,6 +33,7 @@
 #include <vector>
 #include <unordered_map>
 
+#include "Zlib.hh"
 #include "StringUtil.hh"
 #include "MinMax.hh"
 #include "NetworkClass.hh"
@@ -62,13 +63,21 @@ using LibraryGroupVisitorMap = std::unordered_map<std::string, LibraryGroupVisit
 using LibertyPortGroupMap = std::map<const LibertyGroup*, LibertyPortSeq,
                                      LibertyGroupLineLess>;
 using OutputWaveformSeq = std::vector<OutputWaveform>;
-
-class LibertyReader : public LibertyGroupVisitor
+using LibertyGroupBodyMap = std::map<std::string, LibertyGroupBody, std::less<>>;
+using LibertySceneMap = std::pair<Scene*, const MinMaxAll*>;
+using LibertySceneMapSeq = std::vector<LibertySceneMap>;
+
+// With lazy true cell groups are skipped by the scanner and the
+// reader is retained by the library to read them on demand.
+class LibertyReader : public LibertyGroupVisitor,
+                      public LibertyDeferredCells
 {
 public:
   LibertyReader(std::string_view filename,
                 bool infer_latches,
+                bool lazy,
                 Network *network);
+  ~LibertyReader() override;
   LibertyLibrary *readLibertyFile(std::string_view filename);
   LibertyLibrary *library() { return library_; }
   const LibertyLibrary *library() const { return library_; }
@@ -85,6 +94,19 @@ public:
              LibertyGroup *parent_group) override;
   void end(const LibertyGroup *group,
            LibertyGroup *parent_group) override;
+  bool deferGroup(const LibertyGroup *group,
+                  const LibertyGroup *parent_group) override;
+  void endDeferred(const LibertyGroup *group,
+                   LibertyGroup *parent_group,
+                   const LibertyGroupBody &body) override;
+
+  // LibertyDeferredCells
+  size_t cellCount() const override { return deferred_cells_.size(); }
+  LibertyCell *readDeferredCell(std::string_view name) override;
+  void readDeferredCellsMatching(const PatternMatch *pattern) override;
+  void readDeferredCells() override;
+  void addSceneMap(Scene *scene,
+                   const MinMaxAll *min_max) override;
 
   void endCell(const LibertyGroup *group,
                LibertyGroup *library_group);
@@ -110,6 +132,10 @@ public:
                                 std::string_view name_attr);
 
 protected:
+  bool readGroupBody(const LibertyGroupBody &body,
+                     // Return value.
+                     std::string &text);
+  void readOtherLibraryCells(std::string_view cell_name);
   // Library gruops.
   void makeLibrary(const LibertyGroup *library_group);
   void readLibraryAttributes(const LibertyGroup *library_group);
@@ -514,8 +540,9 @@ protected:
                       std::forward<Args>(args)...);
   }
 
-  std::string_view filename_;
+  std::string filename_;
   bool infer_latches_;
+  bool lazy_;
   Report *report_;
   Debug *debug_;
   Network *network_;
@@ -534,6 +561,12 @@ protected:
   float energy_scale_;
   float distance_scale_;
 
+  LibertyGroupBodyMap deferred_cells_;
+  LibertySceneMapSeq scene_maps_;
+  // Stream used to read deferred cell bodies.
+  gzFile deferred_stream_{nullptr};
+  std::string deferred_stream_filename_;
+
   static constexpr char escape_ = '\\';
 
 private:
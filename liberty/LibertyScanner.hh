@@ -29,6 +29,7 @@
 #include <string_view>
 
 #include "LibertyParse.hh"
+#include "LibertyParser.hh"
 
 #ifndef __FLEX_LEXER_H
 #undef yyFlexLexer
@@ -56,9 +57,24 @@ public:
   // Get rid of override virtual function warning.
   using FlexLexer::yylex;
 
+  void setLineno(int line) { yylineno = line; }
+  // Skip the body of the group whose '{' was just read. The next token
+  // returned is the group's closing '}'.
+  void skipGroupBody();
+  // The location of the last group body skipped.
+  const LibertyGroupBody &skippedGroupBody() const { return skipped_body_; }
+
 private:
   bool includeBegin();
   void fileEnd();
+  void skipGroupEnd();
+  void skipLines(LibertyParse::location_type *loc);
+  // Table values and index_N strings are scanned as float lists.
+  static bool isFloatListAttr(std::string_view name);
+  // Parse a quoted string of two or more comma/space separated floats.
+  bool parseFloatList(const std::string &str,
+                      // Return value.
+                      FloatSeq &values);
   void error(const char *msg);
 
   std::istream *stream_;
@@ -67,9 +83,18 @@ private:
   Report *report_;
   std::string token_;
 
+  // Byte offset of the scanner in stream_.
+  size_t offset_{0};
+  int skip_depth_{0};
+  bool skip_include_{false};
+  // The last keyword is a float list attribute name.
+  bool float_list_attr_{false};
+  LibertyGroupBody skipped_body_;
+
   // Previous lex state for include files.
   std::string filename_prev_;
   std::istream *stream_prev_{nullptr};
+  size_t offset_prev_{0};
 };
 
 } // namespace sta
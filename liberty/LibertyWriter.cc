@@ -289,7 +289,7 @@ LibertyWriter::writeBusDcls()
 void
 LibertyWriter::writeCells()
 {
-  LibertyCellIterator cell_iter(library_);
+  LibertyCellIterator cell_iter(library_, true);
   while (cell_iter.hasNext()) {
     const LibertyCell *cell = cell_iter.next();
     writeCell(cell);
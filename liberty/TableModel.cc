@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -36,10 +37,12 @@
 #include "ContainerHelpers.hh"
 #include "EnumNameMap.hh"
 #include "Format.hh"
+#include "Hash.hh"
 #include "LibertyClass.hh"
 #include "Liberty.hh"
 #include "MinMax.hh"
 #include "PocvMode.hh"
+#include "Report.hh"
 #include "TimingModel.hh"
 #include "Transition.hh"
 #include "Units.hh"
@@ -56,6 +59,9 @@ reportPvt(const LibertyCell *cell,
 static void
 appendSpaces(std::string &result,
              int count);
+static size_t
+hashFloats(size_t hash,
+           const FloatSeq &values);
 
 TimingModel::TimingModel(LibertyCell *cell) :
   cell_(cell)
@@ -936,6 +942,50 @@ Table::values3() const
   return (order_ >= 2) ? &values_table_ : nullptr;
 }
 
+size_t
+Table::hash() const
+{
+  size_t hash = hashSum(hash_init_value, order_);
+  hashIncr(hash, std::hash<const TableAxis*>()(axis1_.get()));
+  hashIncr(hash, std::hash<const TableAxis*>()(axis2_.get()));
+  hashIncr(hash, std::hash<const TableAxis*>()(axis3_.get()));
+  switch (order_) {
+    case 0:
+      hashIncr(hash, std::hash<float>()(value_));
+      break;
+    case 1:
+      hash = hashFloats(hash, values1_);
+      break;
+    default:
+      for (const FloatSeq &row : values_table_)
+        hash = hashFloats(hash, row);
+      break;
+  }
+  return hash;
+}
+
+bool
+Table::equal(const Table *table) const
+{
+  return order_ == table->order_
+    && axis1_ == table->axis1_
+    && axis2_ == table->axis2_
+    && axis3_ == table->axis3_
+    && value_ == table->value_
+    && values1_ == table->values1_
+    && values_table_ == table->values_table_;
+}
+
+size_t
+Table::byteSize() const
+{
+  size_t size = sizeof(Table) + values1_.capacity() * sizeof(float)
+    + values_table_.capacity() * sizeof(FloatSeq);
+  for (const FloatSeq &row : values_table_)
+    size += row.capacity() * sizeof(float);
+  return size;
+}
+
 Table::Table() :
   order_(0),
   value_(0.0)
@@ -1704,6 +1754,133 @@ TableAxis::unit(const Units *units)
   return tableVariableUnit(variable_, units);
 }
 
+static size_t
+hashFloats(size_t hash,
+           const FloatSeq &values)
+{
+  for (float value : values)
+    hashIncr(hash, std::hash<float>()(value));
+  return hash;
+}
+
+size_t
+TableAxis::hash() const
+{
+  return hashFloats(hashSum(hash_init_value, static_cast<size_t>(variable_)),
+                    values_);
+}
+
+bool
+TableAxis::equal(const TableAxis *axis) const
+{
+  return variable_ == axis->variable_
+    && values_ == axis->values_;
+}
+
+size_t
+TableAxis::byteSize() const
+{
+  return sizeof(TableAxis) + values_.capacity() * sizeof(float);
+}
+
+////////////////////////////////////////////////////////////////
+
+TableStore::TableStore() :
+  axis_count_(0),
+  axis_shared_count_(0),
+  axis_bytes_saved_(0),
+  table_count_(0),
+  table_shared_count_(0),
+  table_bytes_saved_(0),
+  expire_check_count_(0)
+{
+}
+
+TableAxisPtr
+TableStore::internAxis(TableAxisPtr axis)
+{
+  if (axis == nullptr)
+    return axis;
+  std::lock_guard<std::mutex> lock(lock_);
+  return intern(std::move(axis), axes_, axis_count_, axis_shared_count_,
+                axis_bytes_saved_);
+}
+
+TablePtr
+TableStore::internTable(TablePtr table)
+{
+  if (table == nullptr)
+    return table;
+  std::lock_guard<std::mutex> lock(lock_);
+  return intern(std::move(table), tables_, table_count_, table_shared_count_,
+                table_bytes_saved_);
+}
+
+template <class PTR>
+PTR
+TableStore::intern(PTR obj,
+                   std::unordered_multimap<size_t, std::weak_ptr<typename PTR::element_type>> &objs,
+                   size_t &intern_count,
+                   size_t &shared_count,
+                   size_t &bytes_saved)
+{
+  intern_count++;
+  size_t hash = obj->hash();
+  auto [begin, end] = objs.equal_range(hash);
+  for (auto itr = begin; itr != end; itr++) {
+    PTR existing = itr->second.lock();
+    if (existing && existing->equal(obj.get())) {
+      shared_count++;
+      bytes_saved += obj->byteSize();
+      return existing;
+    }
+  }
+  // Periodically sweep entries for tables freed by deleted libraries.
+  if (++expire_check_count_ > objs.size()) {
+    removeExpired(objs);
+    expire_check_count_ = 0;
+  }
+  objs.emplace(hash, obj);
+  return obj;
+}
+
+template <class T>
+void
+TableStore::removeExpired(std::unordered_multimap<size_t, std::weak_ptr<T>> &objs)
+{
+  for (auto itr = objs.begin(); itr != objs.end(); ) {
+    if (itr->second.expired())
+      itr = objs.erase(itr);
+    else
+      itr++;
+  }
+}
+
+size_t
+TableStore::tableCount()
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  return table_count_;
+}
+
+size_t
+TableStore::tableSharedCount()
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  return table_shared_count_;
+}
+
+void
+TableStore::report(Report *report)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  report->report("            Count  Shared  Bytes saved");
+  report->report("Table axes {:6} {:7} {:12}",
+                 axis_count_, axis_shared_count_, axis_bytes_saved_);
+  report->report("Tables     {:6} {:7} {:12}",
+                 table_count_, table_shared_count_, table_bytes_saved_);
+}
+
 ////////////////////////////////////////////////////////////////
 
 static EnumNameMap<TableAxisVariable> table_axis_variable_map = {
@@ -91,12 +91,22 @@ ConcreteLibrary::cellIterator() const
 ConcreteCell *
 ConcreteLibrary::findCell(std::string_view name) const
 {
-  return findStringKey(cell_map_, name);
+  ConcreteCell *cell = findStringKey(cell_map_, name);
+  if (cell == nullptr)
+    cell = findDeferredCell(name);
+  return cell;
+}
+
+ConcreteCell *
+ConcreteLibrary::findDeferredCell(std::string_view) const
+{
+  return nullptr;
 }
 
 CellSeq
 ConcreteLibrary::findCellsMatching(const PatternMatch *pattern) const
 {
+  readDeferredCellsMatching(pattern);
   CellSeq matches;
   for (auto [name, cell] : cell_map_) {
     if (pattern->match(name))
@@ -105,6 +115,16 @@ ConcreteLibrary::findCellsMatching(const PatternMatch *pattern) const
   return matches;
 }
 
+void
+ConcreteLibrary::readDeferredCellsMatching(const PatternMatch *) const
+{
+}
+
+void
+ConcreteLibrary::readDeferredCells() const
+{
+}
+
 void
 ConcreteLibrary::setBusBrkts(char left,
                              char right)
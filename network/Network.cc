@@ -35,12 +35,14 @@
 #include "PortDirection.hh"
 #include "Scene.hh"
 #include "StringUtil.hh"
+#include "TableModel.hh"
 
 namespace sta {
 
 Network::~Network()
 {
   deleteContents(net_drvr_pin_map_);
+  delete table_store_;
 }
 
 void
@@ -159,6 +161,14 @@ Network::setDefaultLibertyLibrary(LibertyLibrary *library)
   default_liberty_ = library;
 }
 
+TableStore *
+Network::tableStore()
+{
+  if (table_store_ == nullptr)
+    table_store_ = new TableStore;
+  return table_store_;
+}
+
 void
 Network::checkLibertyScenes()
 {
@@ -167,6 +177,7 @@ Network::checkLibertyScenes()
     LibertyCellSet cells;
     while (lib_iter->hasNext()) {
       LibertyLibrary *lib = lib_iter->next();
+      // Cells that have not been read by read_liberty -lazy are skipped.
       LibertyCellIterator cell_iter(lib);
       while (cell_iter.hasNext()) {
         LibertyCell *cell = cell_iter.next();
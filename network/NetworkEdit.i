@@ -95,6 +95,36 @@ disconnect_pin_cmd(Pin *pin)
   Sta::sta()->disconnectPin(pin);
 }
 
+void
+begin_netlist_edit()
+{
+  Sta::sta()->beginNetlistEdit();
+}
+
+void
+end_netlist_edit()
+{
+  Sta::sta()->endNetlistEdit();
+}
+
+void
+begin_what_if()
+{
+  Sta::sta()->beginWhatIf();
+}
+
+void
+commit_what_if()
+{
+  Sta::sta()->commitWhatIf();
+}
+
+void
+discard_what_if()
+{
+  Sta::sta()->discardWhatIf();
+}
+
 // Notify STA of network change.
 void
 network_changed()
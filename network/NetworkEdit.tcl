@@ -269,6 +269,25 @@ proc replace_cell { instance lib_cell } {
 
 ################################################################
 
+define_cmd_args "begin_netlist_edit" {} \
+  -help {Start a batch of network edits. The delay, arrival and level invalidations made by the edits are collected and made once for each graph vertex by `end_netlist_edit`. Batches may be nested. Timing commands in a batch see the edits made so far.}
+
+define_cmd_args "end_netlist_edit" {} \
+  -help {End a batch of network edits started by `begin_netlist_edit`.}
+
+################################################################
+
+define_cmd_args "begin_what_if" {} \
+  -help {Start a what-if session. The `make_instance`, `make_net`, `replace_cell`, `connect_pin` and `disconnect_pin` edits made in the session are undone by `discard_what_if` and kept by `commit_what_if`. Delays and slews changed in the session are saved so discarding the session does not recalculate delays downstream of the edits. `delete_instance` and `delete_net` are not supported in a what-if session.}
+
+define_cmd_args "commit_what_if" {} \
+  -help {Keep the network edits made since `begin_what_if` and end the session.}
+
+define_cmd_args "discard_what_if" {} \
+  -help {Undo the network edits made since `begin_what_if`, restore the saved delays and slews and end the session.}
+
+################################################################
+
 proc path_regexp {} {
   global hierarchy_separator
   set id_regexp "\[^${hierarchy_separator}\]+"
@@ -31,9 +31,9 @@
 #include "Error.hh"
 #include "Liberty.hh"
 #include "MinMax.hh"
-#include "Mutex.hh"
 #include "Network.hh"
 #include "Parasitics.hh"
+#include "Profiler.hh"
 #include "Report.hh"
 #include "Scene.hh"
 #include "Sdc.hh"
@@ -912,7 +912,7 @@ ConcreteParasitics::findPiElmore(const Pin *drvr_pin,
                                  const RiseFall *rf,
                                  const MinMax *min_max) const
 {
-  LockGuard lock(lock_);
+  ProfileLockGuard lock(lock_, "parasitics");
   auto itr = drvr_parasitic_map_.find(drvr_pin);
   if (itr != drvr_parasitic_map_.end()) {
     const MinMaxRiseFallParasitics &parasitics = itr->second;
@@ -931,7 +931,7 @@ ConcreteParasitics::makePiElmore(const Pin *drvr_pin,
                                  float rpi,
                                  float c1)
 {
-  LockGuard lock(lock_);
+  ProfileLockGuard lock(lock_, "parasitics");
   auto itr = drvr_parasitic_map_.find(drvr_pin);
   ConcretePiElmore *pi_elmore = nullptr;
   size_t mm_rf_index = minMaxRiseFallIndex(min_max, rf);
@@ -1029,7 +1029,7 @@ ConcreteParasitics::findPiPoleResidue(const Pin *drvr_pin,
                                       const RiseFall *rf,
                                       const MinMax *min_max) const
 {
-  LockGuard lock(lock_);
+  ProfileLockGuard lock(lock_, "parasitics");
   auto itr = drvr_parasitic_map_.find(drvr_pin);
   if (itr != drvr_parasitic_map_.end()) {
     const MinMaxRiseFallParasitics &parasitics = itr->second;
@@ -1049,7 +1049,7 @@ ConcreteParasitics::makePiPoleResidue(const Pin *drvr_pin,
                                       float rpi,
                                       float c1)
 {
-  LockGuard lock(lock_);
+  ProfileLockGuard lock(lock_, "parasitics");
   auto itr = drvr_parasitic_map_.find(drvr_pin);
   ConcretePiPoleResidue *pi_pole_residue = nullptr;
   size_t mm_rf_index = minMaxRiseFallIndex(min_max, rf);
@@ -1138,7 +1138,7 @@ ConcreteParasitics::isParasiticNetwork(const Parasitic *parasitic) const
 Parasitic *
 ConcreteParasitics::findParasiticNetwork(const Net *net)
 {
-  LockGuard lock(lock_);
+  ProfileLockGuard lock(lock_, "parasitics");
   auto itr = parasitic_network_map_.find(net);
   if (itr != parasitic_network_map_.end())
     return &itr->second;
@@ -1150,7 +1150,7 @@ Parasitic *
 ConcreteParasitics::findParasiticNetwork(const Pin *pin)
 {
   if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
+    ProfileLockGuard lock(lock_, "parasitics");
     if (!parasitic_network_map_.empty()) {
       // Only call findParasiticNet if parasitics exist.
       const Net *net = findParasiticNet(pin);
@@ -1169,7 +1169,7 @@ Parasitic *
 ConcreteParasitics::makeParasiticNetwork(const Net *net,
                                          bool includes_pin_caps)
 {
-  LockGuard lock(lock_);
+  ProfileLockGuard lock(lock_, "parasitics");
   auto itr = parasitic_network_map_.find(net);
   if (itr != parasitic_network_map_.end()) {
     parasitic_network_map_.erase(itr);
@@ -1184,7 +1184,7 @@ ConcreteParasitics::makeParasiticNetwork(const Net *net,
 void
 ConcreteParasitics::deleteParasiticNetwork(const Net *net)
 {
-  LockGuard lock(lock_);
+  ProfileLockGuard lock(lock_, "parasitics");
   parasitic_network_map_.erase(net);
 }
 
@@ -80,6 +80,12 @@ Variables::setDynamicLoopBreaking(bool enable)
   dynamic_loop_breaking_ = enable;
 }
 
+void
+Variables::setGraphFrozenAdjacency(bool enable)
+{
+  graph_frozen_adjacency_ = enable;
+}
+
 void
 Variables::setPropagateAllClocks(bool prop)
 {
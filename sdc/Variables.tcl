@@ -136,6 +136,32 @@ proc trace_input_port_default_clock { name1 name2 op } {
     use_default_arrival_clock set_use_default_arrival_clock
 }
 
+trace add variable ::sta_graph_frozen_adjacency {read write} \
+  sta::trace_graph_frozen_adjacency
+
+proc trace_graph_frozen_adjacency { name1 name2 op } {
+  trace_boolean_var $op ::sta_graph_frozen_adjacency \
+    graph_frozen_adjacency set_graph_frozen_adjacency
+}
+
+trace add variable ::sta_report_checks_cache_size {read write} \
+  sta::trace_report_checks_cache_size
+
+proc trace_report_checks_cache_size { name1 name2 op } {
+  global sta_report_checks_cache_size
+
+  if { $op == "read" } {
+    set sta_report_checks_cache_size [report_checks_cache_size]
+  } elseif { $op == "write" } {
+    if { [string is integer $sta_report_checks_cache_size] \
+           && $sta_report_checks_cache_size >= 0 } {
+      set_report_checks_cache_size $sta_report_checks_cache_size
+    } else {
+      sta_error 595 "sta_report_checks_cache_size must be a positive integer."
+    }
+  }
+}
+
 trace add variable ::sta_propagate_all_clocks {read write} \
   sta::trace_propagate_all_clocks
 
@@ -227,6 +253,12 @@ define_var_help sta_dynamic_loop_breaking {0|1} \
 define_var_help sta_input_port_default_clock {0|1} \
   {When `sta_input_port_default_clock` is 1 a default input arrival is added for input ports that do not have an arrival time specified with the `set_input_delay` command. The default value is 0.}
 
+define_var_help sta_graph_frozen_adjacency {0|1} \
+  {When `sta_graph_frozen_adjacency` is 1, the timing graph edges of each vertex are copied into compressed arrays before searching that are visited instead of the graph edge lists. The arrays are rebuilt by the next search after the netlist is edited. The default value is 0.}
+
+define_var_help sta_report_checks_cache_size {integer} \
+  {The number of `report_checks` reports with -from/-through/-to options to save and reuse until the timing changes. The default value is 0, which disables the cache.}
+
 define_var_help sta_propagate_all_clocks {0|1} \
   {All clocks defined after `sta_propagate_all_clocks` is set to 1 are propagated. If it is set before any clocks are defined it has the same effect as
 
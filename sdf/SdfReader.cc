@@ -24,13 +24,16 @@
 
 #include "sdf/SdfReader.hh"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdarg>
+#include <memory>
 #include <string>
 #include <utility>
 
 #include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "Graph.hh"
 #include "MinMax.hh"
@@ -120,6 +123,7 @@ SdfReader::SdfReader(std::string_view filename,
 
 SdfReader::~SdfReader()
 {
+  deleteContents(instance_stmts_);
   if (unescaped_dividers_)
     delete network_;
 }
@@ -132,8 +136,14 @@ SdfReader::read()
     Stats stats(debug_, report_);
     SdfScanner scanner(&stream, filename_, this, report_);
     scanner_ = &scanner;
+    // Annotations for different instances touch disjoint edges so
+    // CELL statements are collected by instance and annotated in
+    // parallel after the file is parsed.
+    parallel_ = thread_count_ > 1;
     SdfParse parser(&scanner, this);
     bool success = (parser.parse() == 0);
+    if (parallel_)
+      annotateInstanceStmts();
     stats.report("Read sdf");
     return success;
   }
@@ -165,6 +175,12 @@ SdfReader::setTimescale(float multiplier,
     error(181, "TIMESCALE multiplier not 1, 10, or 100.");
 }
 
+SdfCellScope
+SdfReader::cellScope() const
+{
+  return {instance_, in_incremental_, sdfLine(), nullptr};
+}
+
 void
 SdfReader::interconnect(std::string_view from_pin_name,
                         std::string_view to_pin_name,
@@ -178,7 +194,7 @@ SdfReader::interconnect(std::string_view from_pin_name,
       // Assume the pins are non-hierarchical and on the same net.
       Edge *edge = findWireEdge(from_pin, to_pin);
       if (edge)
-        setEdgeDelays(edge, triples, "INTERCONNECT");
+        setEdgeDelays(cellScope(), edge, triples, "INTERCONNECT");
       else {
         bool from_is_hier = network_->isHierarchical(from_pin);
         bool to_is_hier = network_->isHierarchical(to_pin);
@@ -220,7 +236,7 @@ SdfReader::port(std::string_view to_pin_name,
       while (edge_iter.hasNext()) {
         Edge *edge = edge_iter.next();
         if (edge->role()->sdfRole()->isWire())
-          setEdgeDelays(edge, triples, "PORT");
+          setEdgeDelays(cellScope(), edge, triples, "PORT");
       }
     }
   }
@@ -247,7 +263,8 @@ SdfReader::findWireEdge(Pin *from_pin,
 }
 
 void
-SdfReader::setEdgeDelays(Edge *edge,
+SdfReader::setEdgeDelays(const SdfCellScope &scope,
+                         Edge *edge,
                          SdfTripleSeq *triples,
                          std::string_view sdf_cmd)
 {
@@ -262,13 +279,13 @@ SdfReader::setEdgeDelays(Edge *edge,
       else
         triple_index = arc->toEdge()->sdfTripleIndex();
       SdfTriple *triple = (*triples)[triple_index];
-      setEdgeArcDelays(edge, arc, triple);
+      setEdgeArcDelays(scope, edge, arc, triple);
     }
   }
   else if (triple_count == 0)
-    error(188, "{} with no triples.", sdf_cmd);
+    error(scope, 188, "{} with no triples.", sdf_cmd);
   else
-    error(189, "{} with more than 2 triples.", sdf_cmd);
+    error(scope, 189, "{} with more than 2 triples.", sdf_cmd);
 }
 
 void
@@ -318,6 +335,184 @@ SdfReader::cellFinish()
   instance_ = nullptr;
 }
 
+////////////////////////////////////////////////////////////////
+
+enum class SdfStmtType { iopath, timing_check, setup_hold, width, device };
+
+// IOPATH, DEVICE or timing check statement in a CELL.
+// The statement owns its port specs and triples.
+class SdfCellStmt
+{
+public:
+  SdfCellStmt(SdfStmtType type,
+              int line,
+              bool in_incremental);
+  ~SdfCellStmt();
+
+  SdfStmtType type_;
+  int line_;
+  bool in_incremental_;
+  const TimingRole *role1_{nullptr};
+  const TimingRole *role2_{nullptr};
+  SdfPortSpec *edge1_{nullptr};
+  SdfPortSpec *edge2_{nullptr};
+  // IOPATH/DEVICE to port.
+  std::string port_;
+  std::string cond_;
+  bool condelse_{false};
+  SdfTripleSeq *triples_{nullptr};
+  SdfTriple *triple1_{nullptr};
+  SdfTriple *triple2_{nullptr};
+};
+
+using SdfCellStmtSeq = std::vector<SdfCellStmt*>;
+
+SdfCellStmt::SdfCellStmt(SdfStmtType type,
+                         int line,
+                         bool in_incremental) :
+  type_(type),
+  line_(line),
+  in_incremental_(in_incremental)
+{
+}
+
+SdfCellStmt::~SdfCellStmt()
+{
+  delete edge1_;
+  delete edge2_;
+  if (triples_) {
+    deleteContents(triples_);
+    delete triples_;
+  }
+  delete triple1_;
+  delete triple2_;
+}
+
+// Statements for one instance in file order.
+class SdfInstanceStmts
+{
+public:
+  SdfInstanceStmts(Instance *instance);
+  ~SdfInstanceStmts();
+
+  Instance *instance_;
+  SdfCellStmtSeq stmts_;
+  SdfMsgSeq msgs_;
+};
+
+SdfInstanceStmts::SdfInstanceStmts(Instance *instance) :
+  instance_(instance)
+{
+}
+
+SdfInstanceStmts::~SdfInstanceStmts()
+{
+  deleteContents(stmts_);
+}
+
+void
+SdfReader::cellStmt(SdfCellStmt *stmt)
+{
+  if (instance_ == nullptr)
+    delete stmt;
+  else if (parallel_) {
+    auto [itr, inserted] = instance_stmts_index_.try_emplace(instance_,
+                                                             instance_stmts_.size());
+    if (inserted)
+      instance_stmts_.push_back(new SdfInstanceStmts(instance_));
+    instance_stmts_[itr->second]->stmts_.push_back(stmt);
+  }
+  else {
+    std::unique_ptr<SdfCellStmt> stmt_ptr(stmt);
+    annotateStmt(cellScope(), stmt);
+  }
+}
+
+void
+SdfReader::annotateStmt(const SdfCellScope &scope,
+                        SdfCellStmt *stmt)
+{
+  switch (stmt->type_) {
+    case SdfStmtType::iopath:
+      iopath1(scope, stmt->edge1_, stmt->port_, stmt->triples_,
+              stmt->cond_, stmt->condelse_);
+      break;
+    case SdfStmtType::timing_check:
+      timingCheck1(scope, stmt->role1_, stmt->edge1_, stmt->edge2_,
+                   stmt->triple1_);
+      break;
+    case SdfStmtType::setup_hold:
+      timingCheckSetupHold2(scope, stmt->edge1_, stmt->edge2_,
+                            stmt->triple1_, stmt->triple2_,
+                            stmt->role1_, stmt->role2_);
+      break;
+    case SdfStmtType::width:
+      timingCheckWidth1(scope, stmt->edge1_, stmt->triple1_);
+      break;
+    case SdfStmtType::device:
+      device1(scope, stmt->port_, stmt->triples_);
+      break;
+  }
+}
+
+void
+SdfReader::annotateInstanceStmts()
+{
+  size_t inst_count = instance_stmts_.size();
+  if (inst_count > 0) {
+    size_t thread_count = std::min(thread_count_, inst_count);
+    size_t chunk_size = inst_count / thread_count;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count; k++) {
+      // Last thread gets the left overs.
+      size_t to = (k == thread_count - 1) ? inst_count : from + chunk_size;
+      dispatch_queue_->deferTask([=, this](size_t) {
+        for (size_t i = from; i < to; i++) {
+          SdfInstanceStmts *inst_stmts = instance_stmts_[i];
+          for (SdfCellStmt *stmt : inst_stmts->stmts_) {
+            SdfCellScope scope{inst_stmts->instance_, stmt->in_incremental_,
+                               stmt->line_, &inst_stmts->msgs_};
+            annotateStmt(scope, stmt);
+          }
+        }
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+  }
+
+  SdfMsgSeq msgs = std::move(msgs_);
+  for (SdfInstanceStmts *inst_stmts : instance_stmts_) {
+    msgs.insert(msgs.end(), inst_stmts->msgs_.begin(), inst_stmts->msgs_.end());
+    delete inst_stmts;
+  }
+  instance_stmts_.clear();
+  instance_stmts_index_.clear();
+  parallel_ = false;
+  // Report in file order.
+  std::stable_sort(msgs.begin(), msgs.end(),
+                   [](const SdfMsg &msg1, const SdfMsg &msg2) {
+                     return msg1.line < msg2.line;
+                   });
+  reportMsgs(msgs);
+}
+
+void
+SdfReader::reportMsgs(SdfMsgSeq &msgs)
+{
+  // Clear the messages before an error throws.
+  SdfMsgSeq msgs1 = std::move(msgs);
+  msgs.clear();
+  for (const SdfMsg &msg : msgs1) {
+    if (msg.is_error)
+      report_->fileError(msg.id, filename_, msg.line, "{}", msg.msg);
+    else
+      report_->fileWarn(msg.id, filename_, msg.line, "{}", msg.msg);
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
 void
 SdfReader::iopath(SdfPortSpec *from_edge,
                   std::string_view to_port_name,
@@ -325,81 +520,97 @@ SdfReader::iopath(SdfPortSpec *from_edge,
                   std::string_view cond,
                   bool condelse)
 {
-  if (instance_) {
-    std::string_view from_port_name = from_edge->port();
-    Cell *cell = network_->cell(instance_);
-    Port *from_port = findPort(cell, from_port_name);
-    Port *to_port = findPort(cell, to_port_name);
-    if (from_port && to_port) {
-      Pin *from_pin = network_->findPin(instance_, from_port);
-      Pin *to_pin = network_->findPin(instance_, to_port);
-      // Do not report an error if the pin is not found because the
-      // instance may not have the pin.
-      if (from_pin && to_pin) {
-        Vertex *to_vertex = graph_->pinDrvrVertex(to_pin);
-        if (to_vertex) {
-          size_t triple_count = triples->size();
-          bool matched = false;
-          // Fanin < fanout, so search for driver from load.
-          // Search for multiple matching edges because of
-          // tristate enable/disable.
-          VertexInEdgeIterator edge_iter(to_vertex, graph_);
-          while (edge_iter.hasNext()) {
-            Edge *edge = edge_iter.next();
-            TimingArcSet *arc_set = edge->timingArcSet();
-            const std::string &lib_cond = arc_set->sdfCond();
-            const TimingRole *edge_role = arc_set->role();
-            bool cond_use_flag = cond_use_ && !cond.empty() && lib_cond.empty()
-              && !(!is_incremental_only_ && in_incremental_);
-            if (edge->from(graph_)->pin() == from_pin
-                && edge_role->sdfRole() == TimingRole::sdfIopath()
-                && (cond_use_flag
-                    || (!condelse && condMatch(cond, lib_cond))
-                    // condelse matches the default (unconditional) arc.
-                    || (condelse && lib_cond.empty()))) {
-              matched = true;
-              for (TimingArc *arc : arc_set->arcs()) {
-                if ((from_edge->transition() == Transition::riseFall())
-                    || (arc->fromEdge() == from_edge->transition())) {
-                  size_t triple_index = arc->toEdge()->sdfTripleIndex();
-                  SdfTriple *triple = nullptr;
-                  if (triple_index < triple_count)
-                    triple = (*triples)[triple_index];
-                  if (triple_count == 1)
-                    triple = (*triples)[0];
-                  // Rules for matching when triple is missing not implemented.
-                  // See SDF pg 3-17.
-                  if (triple) {
-                    if (cond_use_flag)
-                      setEdgeArcDelaysCondUse(edge, arc, triple);
-                    else
-                      setEdgeArcDelays(edge, arc, triple);
-                  }
+  SdfCellStmt *stmt = new SdfCellStmt(SdfStmtType::iopath, sdfLine(),
+                                      in_incremental_);
+  stmt->edge1_ = from_edge;
+  stmt->port_ = to_port_name;
+  stmt->triples_ = triples;
+  stmt->cond_ = cond;
+  stmt->condelse_ = condelse;
+  cellStmt(stmt);
+}
+
+void
+SdfReader::iopath1(const SdfCellScope &scope,
+                   SdfPortSpec *from_edge,
+                   std::string_view to_port_name,
+                   SdfTripleSeq *triples,
+                   std::string_view cond,
+                   bool condelse)
+{
+  Instance *instance = scope.instance;
+  std::string_view from_port_name = from_edge->port();
+  Cell *cell = network_->cell(instance);
+  Port *from_port = findPort(scope, cell, from_port_name);
+  Port *to_port = findPort(scope, cell, to_port_name);
+  if (from_port && to_port) {
+    Pin *from_pin = network_->findPin(instance, from_port);
+    Pin *to_pin = network_->findPin(instance, to_port);
+    // Do not report an error if the pin is not found because the
+    // instance may not have the pin.
+    if (from_pin && to_pin) {
+      Vertex *to_vertex = graph_->pinDrvrVertex(to_pin);
+      if (to_vertex) {
+        size_t triple_count = triples->size();
+        bool matched = false;
+        // Fanin < fanout, so search for driver from load.
+        // Search for multiple matching edges because of
+        // tristate enable/disable.
+        VertexInEdgeIterator edge_iter(to_vertex, graph_);
+        while (edge_iter.hasNext()) {
+          Edge *edge = edge_iter.next();
+          TimingArcSet *arc_set = edge->timingArcSet();
+          const std::string &lib_cond = arc_set->sdfCond();
+          const TimingRole *edge_role = arc_set->role();
+          bool cond_use_flag = cond_use_ && !cond.empty() && lib_cond.empty()
+            && !(!is_incremental_only_ && scope.in_incremental);
+          if (edge->from(graph_)->pin() == from_pin
+              && edge_role->sdfRole() == TimingRole::sdfIopath()
+              && (cond_use_flag
+                  || (!condelse && condMatch(cond, lib_cond))
+                  // condelse matches the default (unconditional) arc.
+                  || (condelse && lib_cond.empty()))) {
+            matched = true;
+            for (TimingArc *arc : arc_set->arcs()) {
+              if ((from_edge->transition() == Transition::riseFall())
+                  || (arc->fromEdge() == from_edge->transition())) {
+                size_t triple_index = arc->toEdge()->sdfTripleIndex();
+                SdfTriple *triple = nullptr;
+                if (triple_index < triple_count)
+                  triple = (*triples)[triple_index];
+                if (triple_count == 1)
+                  triple = (*triples)[0];
+                // Rules for matching when triple is missing not implemented.
+                // See SDF pg 3-17.
+                if (triple) {
+                  if (cond_use_flag)
+                    setEdgeArcDelaysCondUse(scope, edge, arc, triple);
+                  else
+                    setEdgeArcDelays(scope, edge, arc, triple);
                 }
               }
             }
           }
-          if (!matched)
-            warn(191, "cell {} IOPATH {} -> {} not found.",
-                 network_->cellName(instance_),
-                 from_port_name,
-                 to_port_name);
         }
+        if (!matched)
+          warn(scope, 191, "cell {} IOPATH {} -> {} not found.",
+               network_->cellName(instance),
+               from_port_name,
+               to_port_name);
       }
     }
   }
-  delete from_edge;
-  deleteTripleSeq(triples);
 }
 
 Port *
-SdfReader::findPort(const Cell *cell,
+SdfReader::findPort(const SdfCellScope &scope,
+                    const Cell *cell,
                     std::string_view port_name)
 {
   Port *port = network_->findPort(cell, port_name);
   if (port == nullptr)
-    warn(194, "instance {} port {} not found.", network_->pathName(instance_),
-            port_name);
+    warn(scope, 194, "instance {} port {} not found.",
+         network_->pathName(scope.instance), port_name);
   return port;
 }
 
@@ -409,32 +620,45 @@ SdfReader::timingCheck(const TimingRole *role,
                        SdfPortSpec *clk_edge,
                        SdfTriple *triple)
 {
-  if (instance_) {
-    std::string_view data_port_name = data_edge->port();
-    std::string_view clk_port_name = clk_edge->port();
-    Cell *cell = network_->cell(instance_);
-    Port *data_port = findPort(cell, data_port_name);
-    Port *clk_port = findPort(cell, clk_port_name);
-    if (data_port && clk_port)
-      timingCheck1(role, data_port, data_edge, clk_port, clk_edge, triple);
-  }
-  delete data_edge;
-  delete clk_edge;
-  deleteTriple(triple);
+  SdfCellStmt *stmt = new SdfCellStmt(SdfStmtType::timing_check, sdfLine(),
+                                      in_incremental_);
+  stmt->role1_ = role;
+  stmt->edge1_ = data_edge;
+  stmt->edge2_ = clk_edge;
+  stmt->triple1_ = triple;
+  cellStmt(stmt);
 }
 
 void
-SdfReader::timingCheck1(const TimingRole *role,
-                        Port *data_port,
+SdfReader::timingCheck1(const SdfCellScope &scope,
+                        const TimingRole *role,
                         SdfPortSpec *data_edge,
-                        Port *clk_port,
                         SdfPortSpec *clk_edge,
                         SdfTriple *triple)
+{
+  std::string_view data_port_name = data_edge->port();
+  std::string_view clk_port_name = clk_edge->port();
+  Cell *cell = network_->cell(scope.instance);
+  Port *data_port = findPort(scope, cell, data_port_name);
+  Port *clk_port = findPort(scope, cell, clk_port_name);
+  if (data_port && clk_port)
+    annotateCheck(scope, role, data_port, data_edge, clk_port, clk_edge, triple);
+}
+
+void
+SdfReader::annotateCheck(const SdfCellScope &scope,
+                         const TimingRole *role,
+                         Port *data_port,
+                         SdfPortSpec *data_edge,
+                         Port *clk_port,
+                         SdfPortSpec *clk_edge,
+                         SdfTriple *triple)
 {
   // Ignore non-incremental annotations in incremental only mode.
-  if (!(is_incremental_only_ && !in_incremental_) && instance_) {
-    Pin *data_pin = network_->findPin(instance_, data_port);
-    Pin *clk_pin = network_->findPin(instance_, clk_port);
+  if (!(is_incremental_only_ && !scope.in_incremental)) {
+    Instance *instance = scope.instance;
+    Pin *data_pin = network_->findPin(instance, data_port);
+    Pin *clk_pin = network_->findPin(instance, clk_port);
     if (data_pin && clk_pin) {
       // Hack: always use triple max value for check.
       float **values = triple->values();
@@ -455,26 +679,27 @@ SdfReader::timingCheck1(const TimingRole *role,
             break;
         }
       }
-      bool matched = annotateCheckEdges(data_pin, data_edge, clk_pin, clk_edge, role,
-                                        triple, false);
+      bool matched = annotateCheckEdges(scope, data_pin, data_edge, clk_pin,
+                                        clk_edge, role, triple, false);
       // Liberty setup/hold checks on preset/clear pins can be translated
       // into recovery/removal checks, so be flexible about matching.
       if (!matched)
-        matched = annotateCheckEdges(data_pin, data_edge, clk_pin, clk_edge, role,
-                                     triple, true);
+        matched = annotateCheckEdges(scope, data_pin, data_edge, clk_pin,
+                                     clk_edge, role, triple, true);
       if (!matched
           // Only warn when non-null values are present.
           && triple->hasValue())
-        warn(192, "cell {} {} -> {} {} check not found.",
-                network_->cellName(instance_), network_->name(data_port),
-                network_->name(clk_port), role->to_string());
+        warn(scope, 192, "cell {} {} -> {} {} check not found.",
+             network_->cellName(instance), network_->name(data_port),
+             network_->name(clk_port), role->to_string());
     }
   }
 }
 
 // Return true if matched.
 bool
-SdfReader::annotateCheckEdges(Pin *data_pin,
+SdfReader::annotateCheckEdges(const SdfCellScope &scope,
+                              Pin *data_pin,
                               SdfPortSpec *data_edge,
                               Pin *clk_pin,
                               SdfPortSpec *clk_edge,
@@ -507,7 +732,7 @@ SdfReader::annotateCheckEdges(Pin *data_pin,
                || (arc->toEdge() == data_edge->transition()))
               && ((clk_edge->transition() == Transition::riseFall())
                   || (arc->fromEdge() == clk_edge->transition()))) {
-            setEdgeArcDelays(edge, arc, triple);
+            setEdgeArcDelays(scope, edge, arc, triple);
           }
         }
         matched = true;
@@ -520,26 +745,37 @@ SdfReader::annotateCheckEdges(Pin *data_pin,
 void
 SdfReader::timingCheckWidth(SdfPortSpec *edge,
                             SdfTriple *triple)
+{
+  SdfCellStmt *stmt = new SdfCellStmt(SdfStmtType::width, sdfLine(),
+                                      in_incremental_);
+  stmt->edge1_ = edge;
+  stmt->triple1_ = triple;
+  cellStmt(stmt);
+}
+
+void
+SdfReader::timingCheckWidth1(const SdfCellScope &scope,
+                             SdfPortSpec *edge,
+                             SdfTriple *triple)
 {
   // Ignore non-incremental annotations in incremental only mode.
-  if (!(is_incremental_only_ && !in_incremental_) && instance_) {
+  if (!(is_incremental_only_ && !scope.in_incremental)) {
+    Instance *instance = scope.instance;
     std::string_view port_name = edge->port();
-    Cell *cell = network_->cell(instance_);
-    Port *port = findPort(cell, port_name);
+    Cell *cell = network_->cell(instance);
+    Port *port = findPort(scope, cell, port_name);
     if (port) {
-      Pin *pin = network_->findPin(instance_, port_name);
+      Pin *pin = network_->findPin(instance, port_name);
       if (pin) {
         const RiseFall *rf = edge->transition()->asRiseFall();
         Edge *edge;
         TimingArc *arc;
         graph_->minPulseWidthArc(graph_->pinLoadVertex(pin), rf, edge, arc);
         if (edge)
-          setEdgeArcDelays(edge, arc, triple);
+          setEdgeArcDelays(scope, edge, arc, triple);
       }
     }
   }
-  delete edge;
-  deleteTriple(triple);
 }
 
 void
@@ -569,31 +805,51 @@ SdfReader::timingCheckSetupHold1(SdfPortSpec *data_edge,
                                  SdfTriple *hold_triple,
                                  const TimingRole *setup_role,
                                  const TimingRole *hold_role)
+{
+  SdfCellStmt *stmt = new SdfCellStmt(SdfStmtType::setup_hold, sdfLine(),
+                                      in_incremental_);
+  stmt->role1_ = setup_role;
+  stmt->role2_ = hold_role;
+  stmt->edge1_ = data_edge;
+  stmt->edge2_ = clk_edge;
+  stmt->triple1_ = setup_triple;
+  stmt->triple2_ = hold_triple;
+  cellStmt(stmt);
+}
+
+void
+SdfReader::timingCheckSetupHold2(const SdfCellScope &scope,
+                                 SdfPortSpec *data_edge,
+                                 SdfPortSpec *clk_edge,
+                                 SdfTriple *setup_triple,
+                                 SdfTriple *hold_triple,
+                                 const TimingRole *setup_role,
+                                 const TimingRole *hold_role)
 {
   std::string_view data_port_name = data_edge->port();
   std::string_view clk_port_name = clk_edge->port();
-  Cell *cell = network_->cell(instance_);
-  Port *data_port = findPort(cell, data_port_name);
-  Port *clk_port = findPort(cell, clk_port_name);
+  Cell *cell = network_->cell(scope.instance);
+  Port *data_port = findPort(scope, cell, data_port_name);
+  Port *clk_port = findPort(scope, cell, clk_port_name);
   if (data_port && clk_port) {
-    timingCheck1(setup_role, data_port, data_edge, clk_port, clk_edge, setup_triple);
-    timingCheck1(hold_role, data_port, data_edge, clk_port, clk_edge, hold_triple);
+    annotateCheck(scope, setup_role, data_port, data_edge, clk_port, clk_edge,
+                  setup_triple);
+    annotateCheck(scope, hold_role, data_port, data_edge, clk_port, clk_edge,
+                  hold_triple);
   }
-  delete data_edge;
-  delete clk_edge;
-  deleteTriple(setup_triple);
-  deleteTriple(hold_triple);
 }
 
 void
 SdfReader::timingCheckPeriod(SdfPortSpec *edge,
                              SdfTriple *triple)
 {
+  // Period annotations are not stored on edges so they are not
+  // annotated in parallel.
   // Ignore non-incremental annotations in incremental only mode.
   if (!(is_incremental_only_ && !in_incremental_) && instance_) {
     std::string_view port_name = edge->port();
     Cell *cell = network_->cell(instance_);
-    Port *port = findPort(cell, port_name);
+    Port *port = findPort(cellScope(), cell, port_name);
     if (port) {
       // Edge specifier is ignored for period checks.
       Pin *pin = network_->findPin(instance_, port_name);
@@ -634,36 +890,51 @@ SdfReader::timingCheckNochange(SdfPortSpec *data_edge,
 void
 SdfReader::device(SdfTripleSeq *triples)
 {
-  // Ignore non-incremental annotations in incremental only mode.
-  if (!(is_incremental_only_ && !in_incremental_) && instance_) {
-    InstancePinIterator *pin_iter = network_->pinIterator(instance_);
-    while (pin_iter->hasNext()) {
-      Pin *to_pin = pin_iter->next();
-      setDevicePinDelays(to_pin, triples);
-    }
-    delete pin_iter;
-  }
-  deleteTripleSeq(triples);
+  device("", triples);
 }
 
 void
 SdfReader::device(std::string_view to_port_name,
                   SdfTripleSeq *triples)
+{
+  SdfCellStmt *stmt = new SdfCellStmt(SdfStmtType::device, sdfLine(),
+                                      in_incremental_);
+  stmt->port_ = to_port_name;
+  stmt->triples_ = triples;
+  cellStmt(stmt);
+}
+
+// Empty to_port_name annotates all instance pins.
+void
+SdfReader::device1(const SdfCellScope &scope,
+                   std::string_view to_port_name,
+                   SdfTripleSeq *triples)
 {
   // Ignore non-incremental annotations in incremental only mode.
-  if (!(is_incremental_only_ && !in_incremental_) && instance_) {
-    Cell *cell = network_->cell(instance_);
-    Port *to_port = findPort(cell, to_port_name);
-    if (to_port) {
-      Pin *to_pin = network_->findPin(instance_, to_port_name);
-      setDevicePinDelays(to_pin, triples);
+  if (!(is_incremental_only_ && !scope.in_incremental)) {
+    Instance *instance = scope.instance;
+    if (to_port_name.empty()) {
+      InstancePinIterator *pin_iter = network_->pinIterator(instance);
+      while (pin_iter->hasNext()) {
+        Pin *to_pin = pin_iter->next();
+        setDevicePinDelays(scope, to_pin, triples);
+      }
+      delete pin_iter;
+    }
+    else {
+      Cell *cell = network_->cell(instance);
+      Port *to_port = findPort(scope, cell, to_port_name);
+      if (to_port) {
+        Pin *to_pin = network_->findPin(instance, to_port_name);
+        setDevicePinDelays(scope, to_pin, triples);
+      }
     }
   }
-  deleteTripleSeq(triples);
 }
 
 void
-SdfReader::setDevicePinDelays(Pin *to_pin,
+SdfReader::setDevicePinDelays(const SdfCellScope &scope,
+                              Pin *to_pin,
                               SdfTripleSeq *triples)
 {
   Vertex *vertex = graph_->pinDrvrVertex(to_pin);
@@ -672,22 +943,26 @@ SdfReader::setDevicePinDelays(Pin *to_pin,
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
       if (edge->role()->sdfRole() == TimingRole::sdfIopath())
-        setEdgeDelays(edge, triples, "DEVICE");
+        setEdgeDelays(scope, edge, triples, "DEVICE");
     }
   }
 }
 
 void
-SdfReader::setEdgeArcDelays(Edge *edge,
+SdfReader::setEdgeArcDelays(const SdfCellScope &scope,
+                            Edge *edge,
                             TimingArc *arc,
                             SdfTriple *triple)
 {
-  setEdgeArcDelays(edge, arc, triple, triple_min_index_, arc_delay_min_index_);
-  setEdgeArcDelays(edge, arc, triple, triple_max_index_, arc_delay_max_index_);
+  setEdgeArcDelays(scope, edge, arc, triple, triple_min_index_,
+                   arc_delay_min_index_);
+  setEdgeArcDelays(scope, edge, arc, triple, triple_max_index_,
+                   arc_delay_max_index_);
 }
 
 void
-SdfReader::setEdgeArcDelays(Edge *edge,
+SdfReader::setEdgeArcDelays(const SdfCellScope &scope,
+                            Edge *edge,
                             TimingArc *arc,
                             SdfTriple *triple,
                             int triple_index,
@@ -698,7 +973,7 @@ SdfReader::setEdgeArcDelays(Edge *edge,
     float *value_ptr = values[triple_index];
     if (value_ptr) {
       ArcDelay delay;
-      if (in_incremental_)
+      if (scope.in_incremental)
         delay = delaySum(graph_->arcDelay(edge, arc, arc_delay_index), *value_ptr, this);
       else
         delay = *value_ptr;
@@ -710,7 +985,8 @@ SdfReader::setEdgeArcDelays(Edge *edge,
 }
 
 void
-SdfReader::setEdgeArcDelaysCondUse(Edge *edge,
+SdfReader::setEdgeArcDelaysCondUse(const SdfCellScope &scope,
+                                   Edge *edge,
                                    TimingArc *arc,
                                    SdfTriple *triple)
 {
@@ -730,14 +1006,15 @@ SdfReader::setEdgeArcDelaysCondUse(Edge *edge,
     min = MinMax::min();
     max = MinMax::max();
   }
-  setEdgeArcDelaysCondUse(edge, arc, value_min, triple_min_index_,
+  setEdgeArcDelaysCondUse(scope, edge, arc, value_min, triple_min_index_,
                           arc_delay_min_index_, min);
-  setEdgeArcDelaysCondUse(edge, arc, value_max, triple_max_index_,
+  setEdgeArcDelaysCondUse(scope, edge, arc, value_max, triple_max_index_,
                           arc_delay_max_index_, max);
 }
 
 void
-SdfReader::setEdgeArcDelaysCondUse(Edge *edge,
+SdfReader::setEdgeArcDelaysCondUse(const SdfCellScope &scope,
+                                   Edge *edge,
                                    TimingArc *arc,
                                    const float *value,
                                    int triple_index,
@@ -746,7 +1023,7 @@ SdfReader::setEdgeArcDelaysCondUse(Edge *edge,
 {
   if (value && triple_index != null_index_) {
     ArcDelay delay(*value);
-    if (!is_incremental_only_ && in_incremental_)
+    if (!is_incremental_only_ && scope.in_incremental)
       delay = delaySum(graph_->arcDelay(edge, arc, arc_delay_index), *value, this);
     else if (graph_->arcDelayAnnotated(edge, arc, arc_delay_index)) {
       ArcDelay prev_value = graph_->arcDelay(edge, arc, arc_delay_index);
@@ -950,15 +1227,29 @@ SdfReader::sdfLine() const
 Pin *
 SdfReader::findPin(std::string_view name)
 {
+  std::string path_name;
   if (!path_.empty()) {
-    std::string path_name(path_);
+    path_name = path_;
     path_name += divider_;
     path_name += name;
-    Pin *pin = network_->findPin(path_name);
-    return pin;
   }
   else
-    return network_->findPin(name);
+    path_name = name;
+  if (unescaped_dividers_)
+    return network_->findPin(path_name);
+  else {
+    std::string inst_path, port_name;
+    network_->pathNameLast(path_name, inst_path, port_name);
+    if (inst_path.empty())
+      // Top level pin.
+      return network_->findPin(network_->topInstance(), path_name);
+    else {
+      Instance *inst = findParentInstance(inst_path);
+      if (inst)
+        return network_->findPin(inst, port_name);
+      return nullptr;
+    }
+  }
 }
 
 Instance *
@@ -972,12 +1263,45 @@ SdfReader::findInstance(std::string_view name)
   }
   else
     inst_name = name;
-  Instance *inst = network_->findInstance(inst_name);
+  Instance *inst = findInstancePath(inst_name);
   if (inst == nullptr)
     warn(195, "instance {} not found.", inst_name);
   return inst;
 }
 
+// Instances in an SDF file are usually grouped by hierarchy so look up
+// the parent in a hash table to avoid walking the hierarchy from the
+// top for each instance.
+Instance *
+SdfReader::findInstancePath(const std::string &path_name)
+{
+  if (unescaped_dividers_)
+    return network_->findInstance(path_name);
+  else {
+    std::string parent_path, inst_name;
+    network_->pathNameLast(path_name, parent_path, inst_name);
+    if (parent_path.empty())
+      return network_->findInstance(path_name);
+    else {
+      Instance *parent = findParentInstance(parent_path);
+      if (parent)
+        return network_->findChild(parent, inst_name);
+      return nullptr;
+    }
+  }
+}
+
+Instance *
+SdfReader::findParentInstance(const std::string &parent_name)
+{
+  auto itr = parent_instances_.find(parent_name);
+  if (itr != parent_instances_.end())
+    return itr->second;
+  Instance *parent = network_->findInstance(parent_name);
+  parent_instances_[parent_name] = parent;
+  return parent;
+}
+
 ////////////////////////////////////////////////////////////////
 
 SdfPortSpec::SdfPortSpec(const Transition *tr,
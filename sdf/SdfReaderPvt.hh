@@ -26,6 +26,7 @@
 
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "GraphClass.hh"
@@ -43,8 +44,39 @@ class Report;
 class SdfTriple;
 class SdfPortSpec;
 class SdfScanner;
+class SdfCellStmt;
+class SdfInstanceStmts;
 
 using SdfTripleSeq = std::vector<SdfTriple*>;
+using SdfInstanceStmtsSeq = std::vector<SdfInstanceStmts*>;
+using SdfInstanceStmtsIndex = std::unordered_map<const Instance*, size_t>;
+using SdfInstanceMap = std::unordered_map<std::string, Instance*>;
+
+// Warning or error found while annotating that is reported after
+// the parallel annotation pass in file order.
+class SdfMsg
+{
+public:
+  int line;
+  int id;
+  bool is_error;
+  std::string msg;
+};
+
+using SdfMsgSeq = std::vector<SdfMsg>;
+
+// Parser state used to annotate a statement in a CELL.
+// Statements are annotated in parallel after the file is parsed
+// so they cannot use the parser state.
+class SdfCellScope
+{
+public:
+  Instance *instance;
+  bool in_incremental;
+  int line;
+  // Messages to report after annotation (nullptr reports immediately).
+  SdfMsgSeq *msgs;
+};
 
 class SdfReader : public StaState
 {
@@ -64,21 +96,22 @@ public:
   void setDivider(char divider);
   void setTimescale(float multiplier,
                     std::string_view units);
-  void setPortDeviceDelay(Edge *edge,
-                          SdfTripleSeq *triples,
-                          bool from_trans);
-  void setEdgeArcDelays(Edge *edge,
+  void setEdgeArcDelays(const SdfCellScope &scope,
+                        Edge *edge,
                         TimingArc *arc,
                         SdfTriple *triple);
-  void setEdgeArcDelays(Edge *edge,
+  void setEdgeArcDelays(const SdfCellScope &scope,
+                        Edge *edge,
                         TimingArc *arc,
                         SdfTriple *triple,
                         int triple_index,
                         int arc_delay_index);
-  void setEdgeArcDelaysCondUse(Edge *edge,
+  void setEdgeArcDelaysCondUse(const SdfCellScope &scope,
+                               Edge *edge,
                                TimingArc *arc,
                                SdfTriple *triple);
-  void setEdgeArcDelaysCondUse(Edge *edge,
+  void setEdgeArcDelaysCondUse(const SdfCellScope &scope,
+                               Edge *edge,
                                TimingArc *arc,
                                const float *value,
                                int triple_index,
@@ -160,35 +193,98 @@ public:
                std::string_view fmt,
                Args &&...args)
   {
-    report_->fileWarn(id, filename_, sdfLine(), fmt,
-                     std::forward<Args>(args)...);
+    if (parallel_) {
+      if (!report_->isSuppressed(id))
+        msgs_.push_back({sdfLine(), id, false,
+                         sta::vformat(fmt, sta::make_format_args(args...))});
+    }
+    else
+      report_->fileWarn(id, filename_, sdfLine(), fmt,
+                        std::forward<Args>(args)...);
   }
   template <typename... Args>
   void error(int id,
                 std::string_view fmt,
                 Args &&...args)
   {
+    // Report warnings that precede the error.
+    reportMsgs(msgs_);
     report_->fileError(id, filename_, sdfLine(), fmt,
                       std::forward<Args>(args)...);
   }
+  template <typename... Args>
+  void warn(const SdfCellScope &scope,
+            int id,
+            std::string_view fmt,
+            Args &&...args)
+  {
+    if (scope.msgs) {
+      if (!report_->isSuppressed(id))
+        scope.msgs->push_back({scope.line, id, false,
+                               sta::vformat(fmt, sta::make_format_args(args...))});
+    }
+    else
+      report_->fileWarn(id, filename_, scope.line, fmt,
+                        std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  void error(const SdfCellScope &scope,
+             int id,
+             std::string_view fmt,
+             Args &&...args)
+  {
+    if (scope.msgs)
+      scope.msgs->push_back({scope.line, id, true,
+                             sta::vformat(fmt, sta::make_format_args(args...))});
+    else
+      report_->fileError(id, filename_, scope.line, fmt,
+                         std::forward<Args>(args)...);
+  }
 
 private:
-  Edge *findCheckEdge(Pin *from_pin,
-                      Pin *to_pin,
-                      const TimingRole *sdf_role,
-                      const std::string *cond_start,
-                      const std::string *cond_end);
+  SdfCellScope cellScope() const;
+  void cellStmt(SdfCellStmt *stmt);
+  void annotateStmt(const SdfCellScope &scope,
+                    SdfCellStmt *stmt);
+  void annotateInstanceStmts();
+  void reportMsgs(SdfMsgSeq &msgs);
+  void iopath1(const SdfCellScope &scope,
+               SdfPortSpec *from_edge,
+               std::string_view to_port_name,
+               SdfTripleSeq *triples,
+               std::string_view cond,
+               bool condelse);
+  void timingCheck1(const SdfCellScope &scope,
+                    const TimingRole *role,
+                    SdfPortSpec *data_edge,
+                    SdfPortSpec *clk_edge,
+                    SdfTriple *triple);
+  void timingCheckSetupHold2(const SdfCellScope &scope,
+                             SdfPortSpec *data_edge,
+                             SdfPortSpec *clk_edge,
+                             SdfTriple *setup_triple,
+                             SdfTriple *hold_triple,
+                             const TimingRole *setup_role,
+                             const TimingRole *hold_role);
+  void timingCheckWidth1(const SdfCellScope &scope,
+                         SdfPortSpec *edge,
+                         SdfTriple *triple);
+  void device1(const SdfCellScope &scope,
+               std::string_view to_port_name,
+               SdfTripleSeq *triples);
   Edge *findWireEdge(Pin *from_pin,
                      Pin *to_pin);
   bool condMatch(std::string_view sdf_cond,
                  std::string_view lib_cond);
-  void timingCheck1(const TimingRole *role,
-                    Port *data_port,
-                    SdfPortSpec *data_edge,
-                    Port *clk_port,
-                    SdfPortSpec *clk_edge,
-                    SdfTriple *triple);
-  bool annotateCheckEdges(Pin *data_pin,
+  void annotateCheck(const SdfCellScope &scope,
+                     const TimingRole *role,
+                     Port *data_port,
+                     SdfPortSpec *data_edge,
+                     Port *clk_port,
+                     SdfPortSpec *clk_edge,
+                     SdfTriple *triple);
+  bool annotateCheckEdges(const SdfCellScope &scope,
+                          Pin *data_pin,
                           SdfPortSpec *data_edge,
                           Pin *clk_pin,
                           SdfPortSpec *clk_edge,
@@ -197,12 +293,17 @@ private:
                           bool match_generic);
   Pin *findPin(std::string_view name);
   Instance *findInstance(std::string_view name);
-  void setEdgeDelays(Edge *edge,
+  Instance *findInstancePath(const std::string &path_name);
+  Instance *findParentInstance(const std::string &parent_name);
+  void setEdgeDelays(const SdfCellScope &scope,
+                     Edge *edge,
                      SdfTripleSeq *triples,
                      std::string_view sdf_cmd);
-  void setDevicePinDelays(Pin *to_pin,
+  void setDevicePinDelays(const SdfCellScope &scope,
+                          Pin *to_pin,
                           SdfTripleSeq *triples);
-  Port *findPort(const Cell *cell,
+  Port *findPort(const SdfCellScope &scope,
+                 const Cell *cell,
                  std::string_view port_name);
 
   std::string_view filename_;
@@ -227,6 +328,17 @@ private:
   bool in_incremental_{false};
   float timescale_{1.0E-9F};  // default units of ns
 
+  // Parse the file before annotating CELL statements in parallel.
+  bool parallel_{false};
+  // CELL statements grouped by instance so each instance's edges are
+  // annotated by one thread in file order.
+  SdfInstanceStmtsSeq instance_stmts_;
+  SdfInstanceStmtsIndex instance_stmts_index_;
+  // Parse messages deferred until the parallel annotation is done.
+  SdfMsgSeq msgs_;
+  // Hierarchical instance lookups by parent path name.
+  SdfInstanceMap parent_instances_;
+
   static const int null_index_ = -1;
 };
 
@@ -24,11 +24,14 @@
 
 #include "sdf/SdfWriter.hh"
 
+#include <algorithm>
 #include <cstdio>
 #include <ctime>
 #include <string>
 #include <string_view>
+#include <vector>
 
+#include "DispatchQueue.hh"
 #include "Format.hh"
 #include "Fuzzy.hh"
 #include "Graph.hh"
@@ -48,6 +51,16 @@
 
 namespace sta {
 
+// Instances formatted by each thread per batch.
+static constexpr size_t sdf_chunk_inst_count = 2000;
+// Serial output is flushed to the stream when the buffer reaches this size.
+static constexpr size_t sdf_buffer_size = 1 << 16;
+
+class SdfWriter;
+
+using SdfInstWriter = void (SdfWriter::*)(const Instance *inst,
+                                          std::string &out);
+
 class SdfWriter : public StaState
 {
 public:
@@ -62,52 +75,73 @@ public:
              bool no_version);
 
 protected:
-  void writeHeader(LibertyLibrary *default_lib,
+  void writeHeader(std::string &out,
+                   LibertyLibrary *default_lib,
                    bool no_timestamp,
                    bool no_version);
-  void writeTrailer();
-  void writeInterconnects();
-  void writeInstInterconnects(Instance *inst);
-  void writeInterconnectFromPin(Pin *drvr_pin);
-
-  void writeInstances();
-  void writeInstHeader(const Instance *inst);
-  void writeInstTrailer();
-  void writeIopaths(const Instance *inst,
+  void writeTrailer(std::string &out);
+  void writeInterconnects(const InstanceSeq &insts);
+  void writeInstInterconnects(const Instance *inst,
+                              std::string &out);
+  void writeInterconnectFromPin(std::string &out,
+                                Pin *drvr_pin);
+
+  void writeInstances(const InstanceSeq &insts);
+  void writeInstance(const Instance *inst,
+                     std::string &out);
+  void writeInsts(const InstanceSeq &insts,
+                  SdfInstWriter write_inst);
+  void writeBuffer(std::string &out);
+  void writeInstHeader(std::string &out,
+                       const Instance *inst);
+  void writeInstTrailer(std::string &out);
+  void writeIopaths(std::string &out,
+                    const Instance *inst,
                     bool &inst_header);
-  void writeIopathHeader();
-  void writeIopathTrailer();
-  void writeTimingChecks(const Instance *inst,
+  void writeIopathHeader(std::string &out);
+  void writeIopathTrailer(std::string &out);
+  void writeTimingChecks(std::string &out,
+                         const Instance *inst,
                          bool &inst_header);
-  void ensureTimingCheckheaders(bool &check_header,
+  void ensureTimingCheckheaders(std::string &out,
+                                bool &check_header,
                                 const Instance *inst,
                                 bool &inst_header);
-  void writeCheck(Edge *edge,
+  void writeCheck(std::string &out,
+                  Edge *edge,
                   std::string_view sdf_check);
-  void writeCheck(Edge *edge,
+  void writeCheck(std::string &out,
+                  Edge *edge,
                   TimingArc *arc,
                   std::string_view sdf_check,
                   bool use_data_edge,
                   bool use_clk_edge);
-  void writeEdgeCheck(Edge *edge,
+  void writeEdgeCheck(std::string &out,
+                      Edge *edge,
                       std::string_view sdf_check,
                       int clk_rf_index,
                       TimingArc *arcs[RiseFall::index_count][RiseFall::index_count]);
-  void writeTimingCheckHeader();
-  void writeTimingCheckTrailer();
-  void writeWidthCheck(const Pin *pin,
+  void writeTimingCheckHeader(std::string &out);
+  void writeTimingCheckTrailer(std::string &out);
+  void writeWidthCheck(std::string &out,
+                       const Pin *pin,
                        const RiseFall *hi_low,
                        float min_width,
                        float max_width);
-  void writePeriodCheck(const Pin *pin,
+  void writePeriodCheck(std::string &out,
+                        const Pin *pin,
                         float min_period);
   std::string_view sdfEdge(const Transition *tr);
-  void writeArcDelays(Edge *edge);
-  void writeSdfTriple(RiseFallMinMax &delays,
+  void writeArcDelays(std::string &out,
+                      Edge *edge);
+  void writeSdfTriple(std::string &out,
+                      RiseFallMinMax &delays,
                       const RiseFall *rf);
-  void writeSdfTriple(float min,
+  void writeSdfTriple(std::string &out,
+                      float min,
                       float max);
-  void writeSdfDelay(double delay);
+  void writeSdfDelay(std::string &out,
+                     double delay);
   std::string sdfPortName(const Pin *pin);
   std::string sdfPathName(const Pin *pin);
   std::string sdfPathName(const Instance *inst);
@@ -175,23 +209,33 @@ SdfWriter::write(std::string_view filename,
   if (stream_ == nullptr)
     throw FileNotWritable(filename);
 
-  writeHeader(default_lib, no_timestamp, no_version);
-  writeInterconnects();
-  writeInstances();
-  writeTrailer();
+  InstanceSeq leaf_insts;
+  LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
+  while (leaf_iter->hasNext())
+    leaf_insts.push_back(leaf_iter->next());
+  delete leaf_iter;
+
+  std::string out;
+  writeHeader(out, default_lib, no_timestamp, no_version);
+  writeBuffer(out);
+  writeInterconnects(leaf_insts);
+  writeInstances(leaf_insts);
+  writeTrailer(out);
+  writeBuffer(out);
 
   gzclose(stream_);
   stream_ = nullptr;
 }
 
 void
-SdfWriter::writeHeader(LibertyLibrary *default_lib,
+SdfWriter::writeHeader(std::string &out,
+                       LibertyLibrary *default_lib,
                        bool no_timestamp,
                        bool no_version)
 {
-  sta::print(stream_, "(DELAYFILE\n");
-  sta::print(stream_, " (SDFVERSION \"3.0\")\n");
-  sta::print(stream_, " (DESIGN \"{}\")\n",
+  sta::print(out, "(DELAYFILE\n");
+  sta::print(out, " (SDFVERSION \"3.0\")\n");
+  sta::print(out, " (DESIGN \"{}\")\n",
              network_->cellName(network_->topInstance()));
 
   if (!no_timestamp) {
@@ -200,14 +244,14 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
     char *time_str = ctime(&now);
     // Remove trailing \n.
     time_str[strlen(time_str) - 1] = '\0';
-    sta::print(stream_, " (DATE \"{}\")\n", time_str);
+    sta::print(out, " (DATE \"{}\")\n", time_str);
   }
 
-  sta::print(stream_, " (VENDOR \"Parallax\")\n");
-  sta::print(stream_, " (PROGRAM \"STA\")\n");
+  sta::print(out, " (VENDOR \"Parallax\")\n");
+  sta::print(out, " (PROGRAM \"STA\")\n");
   if (!no_version)
-    sta::print(stream_, " (VERSION \"{}\")\n", STA_VERSION);
-  sta::print(stream_, " (DIVIDER {:c})\n", sdf_divider_);
+    sta::print(out, " (VERSION \"{}\")\n", STA_VERSION);
+  sta::print(out, " (DIVIDER {:c})\n", sdf_divider_);
 
   LibertyLibrary *lib_min = default_lib;
   const LibertySeq &libs_min = scene_->libertyLibraries(MinMax::min());
@@ -221,13 +265,13 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
   OperatingConditions *cond_min = lib_min->defaultOperatingConditions();
   OperatingConditions *cond_max = lib_max->defaultOperatingConditions();
   if (cond_min && cond_max) {
-    sta::print(stream_, " (VOLTAGE {:.3f}::{:.3f})\n",
+    sta::print(out, " (VOLTAGE {:.3f}::{:.3f})\n",
                cond_min->voltage(),
                cond_max->voltage());
-    sta::print(stream_, " (PROCESS \"{:.3f}::{:.3f}\")\n",
+    sta::print(out, " (PROCESS \"{:.3f}::{:.3f}\")\n",
                cond_min->process(),
                cond_max->process());
-    sta::print(stream_, " (TEMPERATURE {:.3f}::{:.3f})\n",
+    sta::print(out, " (TEMPERATURE {:.3f}::{:.3f})\n",
                cond_min->temperature(),
                cond_max->temperature());
   }
@@ -252,53 +296,52 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
   else if (fuzzyEqual(timescale_, 100e-12))
     sdf_timescale = "100ps";
   if (sdf_timescale)
-    sta::print(stream_, " (TIMESCALE {})\n", sdf_timescale);
+    sta::print(out, " (TIMESCALE {})\n", sdf_timescale);
 }
 
 void
-SdfWriter::writeTrailer()
+SdfWriter::writeTrailer(std::string &out)
 {
-  sta::print(stream_, ")\n");
+  sta::print(out, ")\n");
 }
 
 void
-SdfWriter::writeInterconnects()
+SdfWriter::writeInterconnects(const InstanceSeq &insts)
 {
-  sta::print(stream_, " (CELL\n");
-  sta::print(stream_, "  (CELLTYPE \"{}\")\n",
+  std::string out;
+  sta::print(out, " (CELL\n");
+  sta::print(out, "  (CELLTYPE \"{}\")\n",
              network_->cellName(network_->topInstance()));
-  sta::print(stream_, "  (INSTANCE)\n");
-  sta::print(stream_, "  (DELAY\n");
-  sta::print(stream_, "   (ABSOLUTE\n");
-
-  writeInstInterconnects(network_->topInstance());
+  sta::print(out, "  (INSTANCE)\n");
+  sta::print(out, "  (DELAY\n");
+  sta::print(out, "   (ABSOLUTE\n");
+  writeInstInterconnects(network_->topInstance(), out);
+  writeBuffer(out);
 
-  LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
-  while (inst_iter->hasNext()) {
-    Instance *inst = inst_iter->next();
-    writeInstInterconnects(inst);
-  }
-  delete inst_iter;
+  writeInsts(insts, &SdfWriter::writeInstInterconnects);
 
-  sta::print(stream_, "   )\n");
-  sta::print(stream_, "  )\n");
-  sta::print(stream_, " )\n");
+  sta::print(out, "   )\n");
+  sta::print(out, "  )\n");
+  sta::print(out, " )\n");
+  writeBuffer(out);
 }
 
 void
-SdfWriter::writeInstInterconnects(Instance *inst)
+SdfWriter::writeInstInterconnects(const Instance *inst,
+                                  std::string &out)
 {
   InstancePinIterator *pin_iter = network_->pinIterator(inst);
   while (pin_iter->hasNext()) {
     Pin *pin = pin_iter->next();
     if (network_->isDriver(pin))
-      writeInterconnectFromPin(pin);
+      writeInterconnectFromPin(out, pin);
   }
   delete pin_iter;
 }
 
 void
-SdfWriter::writeInterconnectFromPin(Pin *drvr_pin)
+SdfWriter::writeInterconnectFromPin(std::string &out,
+                                    Pin *drvr_pin)
 {
   Vertex *drvr_vertex = graph_->pinDrvrVertex(drvr_pin);
   if (drvr_vertex) {
@@ -309,48 +352,98 @@ SdfWriter::writeInterconnectFromPin(Pin *drvr_pin)
         Pin *load_pin = edge->to(graph_)->pin();
         std::string drvr_pin_name = sdfPathName(drvr_pin);
         std::string load_pin_name = sdfPathName(load_pin);
-        sta::print(stream_, "    (INTERCONNECT {} {} ",
+        sta::print(out, "    (INTERCONNECT {} {} ",
                    drvr_pin_name,
                    load_pin_name);
-        writeArcDelays(edge);
-        sta::print(stream_, ")\n");
+        writeArcDelays(out, edge);
+        sta::print(out, ")\n");
       }
     }
   }
 }
 
 void
-SdfWriter::writeInstances()
+SdfWriter::writeInstances(const InstanceSeq &insts)
 {
-  LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
-  while (leaf_iter->hasNext()) {
-    const Instance *inst = leaf_iter->next();
-    bool inst_header = false;
-    writeIopaths(inst, inst_header);
-    writeTimingChecks(inst, inst_header);
-    if (inst_header)
-      writeInstTrailer();
+  writeInsts(insts, &SdfWriter::writeInstance);
+}
+
+void
+SdfWriter::writeInstance(const Instance *inst,
+                         std::string &out)
+{
+  bool inst_header = false;
+  writeIopaths(out, inst, inst_header);
+  writeTimingChecks(out, inst, inst_header);
+  if (inst_header)
+    writeInstTrailer(out);
+}
+
+// Instances are formatted in chunks into per-thread buffers that are
+// written and compressed in instance order by the calling thread, so
+// the output does not depend on the thread count.
+void
+SdfWriter::writeInsts(const InstanceSeq &insts,
+                      SdfInstWriter write_inst)
+{
+  if (thread_count_ > 1) {
+    std::vector<std::string> buffers(thread_count_);
+    const size_t batch_size = thread_count_ * sdf_chunk_inst_count;
+    for (size_t batch = 0; batch < insts.size(); batch += batch_size) {
+      size_t batch_end = std::min(batch + batch_size, insts.size());
+      for (size_t k = 0; k < thread_count_; k++) {
+        size_t from = batch + k * sdf_chunk_inst_count;
+        size_t to = std::min(from + sdf_chunk_inst_count, batch_end);
+        if (from < to) {
+          std::string *buffer = &buffers[k];
+          dispatch_queue_->deferTask([=, this, &insts](size_t) {
+            for (size_t i = from; i < to; i++)
+              (this->*write_inst)(insts[i], *buffer);
+          });
+        }
+      }
+      dispatch_queue_->finishTasks();
+      for (std::string &buffer : buffers)
+        writeBuffer(buffer);
+    }
   }
-  delete leaf_iter;
+  else {
+    std::string out;
+    for (const Instance *inst : insts) {
+      (this->*write_inst)(inst, out);
+      if (out.size() > sdf_buffer_size)
+        writeBuffer(out);
+    }
+    writeBuffer(out);
+  }
+}
+
+void
+SdfWriter::writeBuffer(std::string &out)
+{
+  gzwrite(stream_, out.data(), out.size());
+  out.clear();
 }
 
 void
-SdfWriter::writeInstHeader(const Instance *inst)
+SdfWriter::writeInstHeader(std::string &out,
+                           const Instance *inst)
 {
-  sta::print(stream_, " (CELL\n");
-  sta::print(stream_, "  (CELLTYPE \"{}\")\n", network_->cellName(inst));
+  sta::print(out, " (CELL\n");
+  sta::print(out, "  (CELLTYPE \"{}\")\n", network_->cellName(inst));
   std::string inst_name = sdfPathName(inst);
-  sta::print(stream_, "  (INSTANCE {})\n", inst_name);
+  sta::print(out, "  (INSTANCE {})\n", inst_name);
 }
 
 void
-SdfWriter::writeInstTrailer()
+SdfWriter::writeInstTrailer(std::string &out)
 {
-  sta::print(stream_, " )\n");
+  sta::print(out, " )\n");
 }
 
 void
-SdfWriter::writeIopaths(const Instance *inst,
+SdfWriter::writeIopaths(std::string &out,
+                        const Instance *inst,
                         bool &inst_header)
 {
   bool iopath_header = false;
@@ -372,27 +465,27 @@ SdfWriter::writeIopaths(const Instance *inst,
           Vertex *to_vertex = edge->to(graph_);
           Pin *to_pin = to_vertex->pin();
           if (!inst_header) {
-            writeInstHeader(inst);
+            writeInstHeader(out, inst);
             inst_header = true;
           }
           if (!iopath_header) {
-            writeIopathHeader();
+            writeIopathHeader(out);
             iopath_header = true;
           }
           const std::string &sdf_cond = edge->timingArcSet()->sdfCond();
           if (!sdf_cond.empty()) {
-            sta::print(stream_, "    (COND {}\n", sdf_cond);
-            sta::print(stream_, " ");
+            sta::print(out, "    (COND {}\n", sdf_cond);
+            sta::print(out, " ");
           }
           std::string from_pin_name = sdfPortName(from_pin);
           std::string to_pin_name = sdfPortName(to_pin);
-          sta::print(stream_, "    (IOPATH {} {} ",
+          sta::print(out, "    (IOPATH {} {} ",
                      from_pin_name,
                      to_pin_name);
-          writeArcDelays(edge);
+          writeArcDelays(out, edge);
           if (!sdf_cond.empty())
-            sta::print(stream_, ")");
-          sta::print(stream_, ")\n");
+            sta::print(out, ")");
+          sta::print(out, ")\n");
         }
       }
     }
@@ -400,25 +493,26 @@ SdfWriter::writeIopaths(const Instance *inst,
   delete pin_iter;
 
   if (iopath_header)
-    writeIopathTrailer();
+    writeIopathTrailer(out);
 }
 
 void
-SdfWriter::writeIopathHeader()
+SdfWriter::writeIopathHeader(std::string &out)
 {
-  sta::print(stream_, "  (DELAY\n");
-  sta::print(stream_, "   (ABSOLUTE\n");
+  sta::print(out, "  (DELAY\n");
+  sta::print(out, "   (ABSOLUTE\n");
 }
 
 void
-SdfWriter::writeIopathTrailer()
+SdfWriter::writeIopathTrailer(std::string &out)
 {
-  sta::print(stream_, "   )\n");
-  sta::print(stream_, "  )\n");
+  sta::print(out, "   )\n");
+  sta::print(out, "  )\n");
 }
 
 void
-SdfWriter::writeArcDelays(Edge *edge)
+SdfWriter::writeArcDelays(std::string &out,
+                          Edge *edge)
 {
   RiseFallMinMax delays;
   TimingArcSet *arc_set = edge->timingArcSet();
@@ -434,61 +528,65 @@ SdfWriter::writeArcDelays(Edge *edge)
   if (delays.hasValue(RiseFall::rise(), MinMax::min())
       && delays.hasValue(RiseFall::fall(), MinMax::min())) {
     // Rise and fall.
-    writeSdfTriple(delays, RiseFall::rise());
+    writeSdfTriple(out, delays, RiseFall::rise());
     // Merge rise/fall values if they are the same.
     if (!(fuzzyEqual(delays.value(RiseFall::rise(), MinMax::min()),
                      delays.value(RiseFall::fall(), MinMax::min()))
           && fuzzyEqual(delays.value(RiseFall::rise(), MinMax::max()),
                         delays.value(RiseFall::fall(),MinMax::max())))) {
-      sta::print(stream_, " ");
-      writeSdfTriple(delays, RiseFall::fall());
+      sta::print(out, " ");
+      writeSdfTriple(out, delays, RiseFall::fall());
     }
   }
   else if (delays.hasValue(RiseFall::rise(), MinMax::min()))
     // Rise only.
-    writeSdfTriple(delays, RiseFall::rise());
+    writeSdfTriple(out, delays, RiseFall::rise());
   else if (delays.hasValue(RiseFall::fall(), MinMax::min())) {
     // Fall only.
-    sta::print(stream_, "() ");
-    writeSdfTriple(delays, RiseFall::fall());
+    sta::print(out, "() ");
+    writeSdfTriple(out, delays, RiseFall::fall());
   }
 }
 
 void
-SdfWriter::writeSdfTriple(RiseFallMinMax &delays,
+SdfWriter::writeSdfTriple(std::string &out,
+                          RiseFallMinMax &delays,
                           const RiseFall *rf)
 {
   float min = delays.value(rf, MinMax::min());
   float max = delays.value(rf, MinMax::max());
-  writeSdfTriple(min, max);
+  writeSdfTriple(out, min, max);
 }
 
 void
-SdfWriter::writeSdfTriple(float min,
+SdfWriter::writeSdfTriple(std::string &out,
+                          float min,
                           float max)
 {
-  sta::print(stream_, "(");
-  writeSdfDelay(min);
+  sta::print(out, "(");
+  writeSdfDelay(out, min);
   if (include_typ_) {
-    sta::print(stream_, ":");
-    writeSdfDelay((min + max) / 2.0);
-    sta::print(stream_, ":");
+    sta::print(out, ":");
+    writeSdfDelay(out, (min + max) / 2.0);
+    sta::print(out, ":");
   }
   else
-    sta::print(stream_, "::");
-  writeSdfDelay(max);
-  sta::print(stream_, ")");
+    sta::print(out, "::");
+  writeSdfDelay(out, max);
+  sta::print(out, ")");
 }
 
 void
-SdfWriter::writeSdfDelay(double delay)
+SdfWriter::writeSdfDelay(std::string &out,
+                         double delay)
 {
   std::string str = sta::formatRuntime("{:.{}f}", delay / timescale_, digits_);
-  sta::print(stream_, "{}", str);
+  sta::print(out, "{}", str);
 }
 
 void
-SdfWriter::writeTimingChecks(const Instance *inst,
+SdfWriter::writeTimingChecks(std::string &out,
+                             const Instance *inst,
                              bool &inst_header)
 {
   bool check_header = false;
@@ -512,8 +610,8 @@ SdfWriter::writeTimingChecks(const Instance *inst,
         else if (role == TimingRole::removal())
           sdf_check = "REMOVAL";
         if (sdf_check) {
-          ensureTimingCheckheaders(check_header, inst, inst_header);
-          writeCheck(edge, sdf_check);
+          ensureTimingCheckheaders(out, check_header, inst, inst_header);
+          writeCheck(out, edge, sdf_check);
         }
       }
       for (auto hi_low : RiseFall::range()) {
@@ -526,54 +624,56 @@ SdfWriter::writeTimingChecks(const Instance *inst,
                                    MinMax::min(), this);
           max_width = delayAsFloat(graph_->arcDelay(edge, arc, arc_delay_max_index_),
                                    MinMax::max(), this);
-          ensureTimingCheckheaders(check_header, inst, inst_header);
-          writeWidthCheck(pin, hi_low, min_width, max_width);
+          ensureTimingCheckheaders(out, check_header, inst, inst_header);
+          writeWidthCheck(out, pin, hi_low, min_width, max_width);
         }
       }
       float min_period;
       bool exists;
       graph_delay_calc_->minPeriod(pin, scene_, min_period, exists);
       if (exists) {
-        ensureTimingCheckheaders(check_header, inst, inst_header);
-        writePeriodCheck(pin, min_period);
+        ensureTimingCheckheaders(out, check_header, inst, inst_header);
+        writePeriodCheck(out, pin, min_period);
       }
     }
   }
   delete pin_iter;
 
   if (check_header)
-    writeTimingCheckTrailer();
+    writeTimingCheckTrailer(out);
 }
 
 void
-SdfWriter::ensureTimingCheckheaders(bool &check_header,
+SdfWriter::ensureTimingCheckheaders(std::string &out,
+                                    bool &check_header,
                                     const Instance *inst,
                                     bool &inst_header)
 {
   if (!inst_header) {
-    writeInstHeader(inst);
+    writeInstHeader(out, inst);
     inst_header = true;
   }
   if (!check_header) {
-    writeTimingCheckHeader();
+    writeTimingCheckHeader(out);
     check_header = true;
   }
 }
 
 void
-SdfWriter::writeTimingCheckHeader()
+SdfWriter::writeTimingCheckHeader(std::string &out)
 {
-  sta::print(stream_, "  (TIMINGCHECK\n");
+  sta::print(out, "  (TIMINGCHECK\n");
 }
 
 void
-SdfWriter::writeTimingCheckTrailer()
+SdfWriter::writeTimingCheckTrailer(std::string &out)
 {
-  sta::print(stream_, "  )\n");
+  sta::print(out, "  )\n");
 }
 
 void
-SdfWriter::writeCheck(Edge *edge,
+SdfWriter::writeCheck(std::string &out,
+                      Edge *edge,
                       std::string_view sdf_check)
 {
   TimingArcSet *arc_set = edge->timingArcSet();
@@ -588,19 +688,20 @@ SdfWriter::writeCheck(Edge *edge,
 
   if (arcs[RiseFall::fallIndex()][RiseFall::riseIndex()] == nullptr
       && arcs[RiseFall::fallIndex()][RiseFall::fallIndex()] == nullptr)
-    writeEdgeCheck(edge, sdf_check, RiseFall::riseIndex(), arcs);
+    writeEdgeCheck(out, edge, sdf_check, RiseFall::riseIndex(), arcs);
   else if (arcs[RiseFall::riseIndex()][RiseFall::riseIndex()] == nullptr
            && arcs[RiseFall::riseIndex()][RiseFall::fallIndex()] == nullptr)
-    writeEdgeCheck(edge, sdf_check, RiseFall::fallIndex(), arcs);
+    writeEdgeCheck(out, edge, sdf_check, RiseFall::fallIndex(), arcs);
   else {
     // No special case; write all the checks with data and clock edge specifiers.
     for (TimingArc *arc : arc_set->arcs())
-      writeCheck(edge, arc, sdf_check, true, true);
+      writeCheck(out, edge, arc, sdf_check, true, true);
   }
 }
 
 void
-SdfWriter::writeEdgeCheck(Edge *edge,
+SdfWriter::writeEdgeCheck(std::string &out,
+                          Edge *edge,
                           std::string_view sdf_check,
                           int clk_rf_index,
                           TimingArc *arcs[RiseFall::index_count][RiseFall::index_count])
@@ -632,21 +733,22 @@ SdfWriter::writeEdgeCheck(Edge *edge,
     if (fuzzyEqual(rise_min, fall_min)
         && fuzzyEqual(rise_max, fall_max)) {
       // Rise/fall margins are the same, so no data edge specifier is required.
-      writeCheck(edge, arcs[clk_rf_index][RiseFall::riseIndex()],
+      writeCheck(out, edge, arcs[clk_rf_index][RiseFall::riseIndex()],
                  sdf_check, false, true);
       return;
     }
   }
   if (arcs[clk_rf_index][RiseFall::riseIndex()])
-    writeCheck(edge, arcs[clk_rf_index][RiseFall::riseIndex()], 
+    writeCheck(out, edge, arcs[clk_rf_index][RiseFall::riseIndex()], 
                sdf_check, true, true);
   if (arcs[clk_rf_index][RiseFall::fallIndex()])
-    writeCheck(edge, arcs[clk_rf_index][RiseFall::fallIndex()],
+    writeCheck(out, edge, arcs[clk_rf_index][RiseFall::fallIndex()],
                sdf_check, true, true);
 }
 
 void
-SdfWriter::writeCheck(Edge *edge,
+SdfWriter::writeCheck(std::string &out,
+                      Edge *edge,
                       TimingArc *arc,
                       std::string_view sdf_check,
                       bool use_data_edge,
@@ -658,72 +760,74 @@ SdfWriter::writeCheck(Edge *edge,
   const std::string &sdf_cond_start = arc_set->sdfCondStart();
   const std::string &sdf_cond_end = arc_set->sdfCondEnd();
 
-  sta::print(stream_, "    ({} ", sdf_check);
+  sta::print(out, "    ({} ", sdf_check);
 
   if (!sdf_cond_start.empty())
-    sta::print(stream_, "(COND {} ", sdf_cond_start);
+    sta::print(out, "(COND {} ", sdf_cond_start);
 
   std::string to_pin_name = sdfPortName(to_pin);
   if (use_data_edge) {
-    sta::print(stream_, "({} {})",
+    sta::print(out, "({} {})",
                sdfEdge(arc->toEdge()),
                to_pin_name);
   }
   else
-    sta::print(stream_, "{}", to_pin_name);
+    sta::print(out, "{}", to_pin_name);
 
   if (!sdf_cond_start.empty())
-    sta::print(stream_, ")");
+    sta::print(out, ")");
 
-  sta::print(stream_, " ");
+  sta::print(out, " ");
 
   if (!sdf_cond_end.empty())
-    sta::print(stream_, "(COND {} ", sdf_cond_end);
+    sta::print(out, "(COND {} ", sdf_cond_end);
 
   std::string from_pin_name = sdfPortName(from_pin);
   if (use_clk_edge)
-    sta::print(stream_, "({} {})",
+    sta::print(out, "({} {})",
                sdfEdge(arc->fromEdge()),
                from_pin_name);
   else
-    sta::print(stream_, "{}", from_pin_name);
+    sta::print(out, "{}", from_pin_name);
 
   if (!sdf_cond_end.empty())
-    sta::print(stream_, ")");
+    sta::print(out, ")");
 
-  sta::print(stream_, " ");
+  sta::print(out, " ");
 
   float min_delay = delayAsFloat(graph_->arcDelay(edge, arc, arc_delay_min_index_),
                                  MinMax::min(), this);
   float max_delay = delayAsFloat(graph_->arcDelay(edge, arc, arc_delay_max_index_),
                                  MinMax::max(), this);
-  writeSdfTriple(min_delay, max_delay);
+  writeSdfTriple(out, min_delay, max_delay);
 
-  sta::print(stream_, ")\n");
+  sta::print(out, ")\n");
 }
 
 void
-SdfWriter::writeWidthCheck(const Pin *pin,
+SdfWriter::writeWidthCheck(std::string &out,
+                           const Pin *pin,
                            const RiseFall *hi_low,
                            float min_width,
                            float max_width)
 {
   std::string pin_name = sdfPortName(pin);
-  sta::print(stream_, "    (WIDTH ({} {}) ",
+  sta::print(out, "    (WIDTH ({} {}) ",
              sdfEdge(hi_low->asTransition()),
              pin_name);
-  writeSdfTriple(min_width, max_width);
-  sta::print(stream_, ")\n");
+  writeSdfTriple(out, min_width, max_width);
+  sta::print(out, ")\n");
 }
 
 void
-SdfWriter::writePeriodCheck(const Pin *pin,
+SdfWriter::writePeriodCheck(std::string &out,
+                            const Pin *pin,
                             float min_period)
 {
   std::string pin_name = sdfPortName(pin);
-  sta::print(stream_, "    (PERIOD {} ", pin_name);
-  writeSdfTriple(min_period, min_period);
-  sta::print(stream_, ")\n");
+  sta::print(out, "    (PERIOD {} ", pin_name);
+  writeSdfTriple(out, min_period, min_period);
+  sta::print(out, ")\n");
 }
 
 std::string_view
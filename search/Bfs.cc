@@ -30,6 +30,7 @@
 #include "Levelize.hh"
 #include "Mutex.hh"
 #include "Network.hh"
+#include "Profiler.hh"
 #include "Report.hh"
 #include "Sdc.hh"
 #include "SearchPred.hh"
@@ -127,6 +128,7 @@ int
 BfsIterator::visit(Level to_level,
                    VertexVisitor *visitor)
 {
+  graph_->ensureFrozenAdjacency();
   int visit_count = 0;
   while (levelLessOrEqual(first_level_, last_level_)
          && levelLessOrEqual(first_level_, to_level)) {
@@ -150,6 +152,21 @@ BfsIterator::visit(Level to_level,
   return visit_count;
 }
 
+const char *
+BfsIterator::profileLevelName() const
+{
+  switch (bfs_index_) {
+  case BfsIndex::dcalc:
+    return "dcalc level";
+  case BfsIndex::arrival:
+    return "arrival level";
+  case BfsIndex::required:
+    return "required level";
+  default:
+    return "bfs level";
+  }
+}
+
 int
 BfsIterator::visitParallel(Level to_level,
                            VertexVisitor *visitor)
@@ -157,6 +174,7 @@ BfsIterator::visitParallel(Level to_level,
   size_t thread_count = thread_count_;
   int visit_count = 0;
   if (!empty()) {
+    graph_->ensureFrozenAdjacency();
     if (thread_count == 1)
       visit_count = visit(to_level, visitor);
     else {
@@ -170,6 +188,7 @@ BfsIterator::visitParallel(Level to_level,
         Level level = first_level_;
         incrLevel(first_level_);
         if (!level_vertices.empty()) {
+          ProfileScope profile(profileLevelName(), "level", level);
           size_t vertex_count = level_vertices.size();
           if (vertex_count < thread_count) {
             for (Vertex *vertex : level_vertices) {
@@ -187,7 +206,7 @@ BfsIterator::visitParallel(Level to_level,
             for (size_t k = 0; k < thread_count; k++) {
               // Last thread gets the left overs.
               size_t to = (k == thread_count - 1) ? vertex_count : from + chunk_size;
-              dispatch_queue_->dispatch([=, this](size_t) {
+              dispatch_queue_->deferTask([=, this](size_t) {
                 for (size_t i = from; i < to; i++) {
                   Vertex *vertex = level_vertices[i];
                   if (vertex) {
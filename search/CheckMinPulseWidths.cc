@@ -223,8 +223,7 @@ MinPulseWidthCheck::closePath(const StaState *sta) const
                 open_tag->isClock(),
                 open_tag->inputDelay(),
                 open_tag->isSegmentStart(),
-                open_tag->states(),
-                false);
+                open_tag->states());
   debugPrint(sta->debug(), "mpw", 3, " open  {}",
              open_tag->to_string(sta));
   debugPrint(sta->debug(), "mpw", 3, " close {}",
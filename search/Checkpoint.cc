@@ -0,0 +1,348 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "Checkpoint.hh"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "Error.hh"
+#include "Format.hh"
+#include "Hash.hh"
+#include "Report.hh"
+#include "Variables.hh"
+#include "Liberty.hh"
+#include "Network.hh"
+#include "TimingArc.hh"
+#include "Mode.hh"
+#include "Scene.hh"
+#include "sdc/WriteSdc.hh"
+#include "Parasitics.hh"
+#include "Graph.hh"
+#include "GraphDelayCalc.hh"
+
+namespace sta {
+
+static constexpr char checkpoint_magic[8] = {'O','S','T','A','C','K','P','T'};
+
+Checkpoint::Checkpoint(StaState *sta) :
+  StaState(sta)
+{
+}
+
+Checkpoint::Header
+Checkpoint::makeHeader()
+{
+  Header header;
+  // Zero the padding so the file contents are deterministic.
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+  header.version = version;
+  header.delay_float_count = variables_->pocvEnabled()
+    ? sizeof(Delay) / sizeof(float)
+    : 1;
+  header.ap_count = graph_->apCount();
+  header.vertex_count = graph_->vertexCount();
+  header.edge_count = graph_->edgeCount();
+  header.fingerprint = fingerprint();
+  return header;
+}
+
+// The delays depend on the liberty and parasitics files and the
+// constraints, which are read again before the checkpoint.
+uint64_t
+Checkpoint::fingerprint()
+{
+  size_t hash = hash_init_value;
+  LibertyLibraryIterator *lib_iter = network_->libertyLibraryIterator();
+  while (lib_iter->hasNext()) {
+    LibertyLibrary *lib = lib_iter->next();
+    hashIncr(hash, hashString(lib->name()));
+    hashFile(lib->filename(), hash);
+  }
+  delete lib_iter;
+
+  for (const Scene *scene : scenes_) {
+    hashIncr(hash, hashString(scene->name()));
+    for (const MinMax *min_max : MinMax::range()) {
+      const Parasitics *parasitics = scene->parasitics(min_max);
+      if (parasitics) {
+        hashIncr(hash, hashString(parasitics->name()));
+        hashFile(parasitics->filename(), hash);
+      }
+    }
+  }
+
+  for (const Mode *mode : modes_) {
+    hashIncr(hash, hashString(mode->name()));
+    hashIncr(hash, sdcHash(mode->sdc()));
+  }
+  return hash;
+}
+
+// Files are identified by name, size and modification time rather than
+// their contents to avoid reading them again.
+void
+Checkpoint::hashFile(const std::string &filename,
+                     size_t &hash)
+{
+  hashIncr(hash, hashString(filename));
+  std::error_code ec;
+  std::uintmax_t size = std::filesystem::file_size(filename, ec);
+  if (!ec)
+    hashIncr(hash, size);
+  std::filesystem::file_time_type time =
+    std::filesystem::last_write_time(filename, ec);
+  if (!ec)
+    hashIncr(hash, time.time_since_epoch().count());
+}
+
+// The constraints are hashed from their write_sdc text.
+size_t
+Checkpoint::sdcHash(const Sdc *sdc)
+{
+  std::filesystem::path sdc_path = std::filesystem::temp_directory_path()
+    / sta::format("sta_checkpoint_{}.sdc", std::random_device()());
+  std::string sdc_filename = sdc_path.string();
+  writeSdc(sdc, network_->topInstance(), sdc_filename, "write_checkpoint",
+           false, false, 9, false, true);
+  std::ifstream sdc_stream(sdc_filename);
+  std::stringstream sdc_text;
+  sdc_text << sdc_stream.rdbuf();
+  sdc_stream.close();
+  std::error_code ec;
+  std::filesystem::remove(sdc_path, ec);
+  return hashString(sdc_text.str());
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+Checkpoint::write(std::string_view filename)
+{
+  filename_ = filename;
+  stream_ = fopen(std::string(filename).c_str(), "wb");
+  if (stream_ == nullptr)
+    throw FileNotWritable(filename);
+
+  Header header = makeHeader();
+  writeBytes(&header, sizeof(header));
+  size_t slew_float_count = graph_->slewCount() * header.delay_float_count;
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    uint32_t vertex_id = graph_->id(vertex);
+    writeBytes(&vertex_id, sizeof(vertex_id));
+    writeBytes(vertex->slewsFloat(), slew_float_count * sizeof(float));
+    uint8_t slew_annotated = vertex->slew_annotated_;
+    writeBytes(&slew_annotated, sizeof(slew_annotated));
+    const float *periods = vertex->isBidirectDriver()
+      ? nullptr
+      : graph_->periodCheckAnnotations(vertex->pin());
+    uint8_t period_annotated = periods != nullptr;
+    writeBytes(&period_annotated, sizeof(period_annotated));
+    if (periods)
+      writeBytes(periods, header.ap_count * sizeof(float));
+  }
+
+  DcalcAPIndex ap_count = header.ap_count;
+  VertexIterator edge_vertex_iter(graph_);
+  while (edge_vertex_iter.hasNext()) {
+    Vertex *vertex = edge_vertex_iter.next();
+    VertexOutEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      const TimingArcSet *arc_set = edge->timingArcSet();
+      EdgeRecord record{graph_->id(vertex), edge->to(),
+                        static_cast<uint32_t>(arc_set->arcCount())};
+      writeBytes(&record, sizeof(record));
+      size_t delay_count = record.arc_count * ap_count;
+      writeBytes(edge->arcDelays(),
+                 delay_count * header.delay_float_count * sizeof(float));
+      annotated_.resize(delay_count);
+      for (const TimingArc *arc : arc_set->arcs()) {
+        for (DcalcAPIndex ap_index = 0; ap_index < ap_count; ap_index++)
+          annotated_[arc->index() * ap_count + ap_index] =
+            graph_->arcDelayAnnotated(edge, arc, ap_index);
+      }
+      writeBytes(annotated_.data(), delay_count);
+      uint8_t incremental = edge->delay_Annotation_Is_Incremental();
+      writeBytes(&incremental, sizeof(incremental));
+    }
+  }
+  bool failed = fclose(stream_) != 0;
+  stream_ = nullptr;
+  if (failed)
+    throw FileNotWritable(filename);
+}
+
+void
+Checkpoint::writeBytes(const void *bytes,
+                       size_t size)
+{
+  if (fwrite(bytes, 1, size, stream_) != size) {
+    fclose(stream_);
+    stream_ = nullptr;
+    throw FileNotWritable(filename_);
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+Checkpoint::read(std::string_view filename)
+{
+  filename_ = filename;
+  stream_ = fopen(std::string(filename).c_str(), "rb");
+  if (stream_ == nullptr)
+    throw FileNotReadable(filename);
+
+  Header header;
+  readBytes(&header, sizeof(header));
+  if (memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) != 0) {
+    fclose(stream_);
+    stream_ = nullptr;
+    report_->error(1593, "{} is not a checkpoint file.", filename);
+  }
+  if (header.version != version) {
+    fclose(stream_);
+    stream_ = nullptr;
+    report_->error(1594, "{} checkpoint version {} is not supported.",
+                   filename, header.version);
+  }
+  Header expected = makeHeader();
+  if (header.fingerprint != expected.fingerprint) {
+    fclose(stream_);
+    stream_ = nullptr;
+    report_->error(1612, "{} checkpoint liberty, parasitics or constraints do not match.",
+                   filename);
+  }
+  if (header.delay_float_count != expected.delay_float_count
+      || header.ap_count != expected.ap_count
+      || header.vertex_count != expected.vertex_count
+      || header.edge_count != expected.edge_count)
+    mismatch();
+
+  graph_->removePeriodCheckAnnotations();
+  size_t slew_float_count = graph_->slewCount() * header.delay_float_count;
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    readVertex(vertex, slew_float_count);
+  }
+  VertexIterator edge_vertex_iter(graph_);
+  while (edge_vertex_iter.hasNext()) {
+    Vertex *vertex = edge_vertex_iter.next();
+    VertexOutEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      readEdge(edge, header.delay_float_count);
+    }
+  }
+  // Trailing bytes mean the file was written from a different graph.
+  if (fgetc(stream_) != EOF)
+    mismatch();
+  fclose(stream_);
+  stream_ = nullptr;
+  graph_delay_calc_->delaysRestored();
+}
+
+void
+Checkpoint::readVertex(Vertex *vertex,
+                       size_t slew_float_count)
+{
+  uint32_t vertex_id;
+  readBytes(&vertex_id, sizeof(vertex_id));
+  if (vertex_id != graph_->id(vertex))
+    mismatch();
+  readBytes(vertex->slewsFloat(), slew_float_count * sizeof(float));
+  uint8_t slew_annotated;
+  readBytes(&slew_annotated, sizeof(slew_annotated));
+  vertex->slew_annotated_ = slew_annotated;
+  uint8_t period_annotated;
+  readBytes(&period_annotated, sizeof(period_annotated));
+  if (period_annotated) {
+    DcalcAPIndex ap_count = graph_->apCount();
+    floats_.resize(ap_count);
+    readBytes(floats_.data(), ap_count * sizeof(float));
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count; ap_index++)
+      graph_->setPeriodCheckAnnotation(vertex->pin(), ap_index,
+                                       floats_[ap_index]);
+  }
+}
+
+void
+Checkpoint::readEdge(Edge *edge,
+                     size_t delay_float_count)
+{
+  const TimingArcSet *arc_set = edge->timingArcSet();
+  EdgeRecord record;
+  readBytes(&record, sizeof(record));
+  if (record.from_id != edge->from()
+      || record.to_id != edge->to()
+      || record.arc_count != arc_set->arcCount())
+    mismatch();
+  DcalcAPIndex ap_count = graph_->apCount();
+  size_t delay_count = record.arc_count * ap_count;
+  readBytes(edge->arcDelays(), delay_count * delay_float_count * sizeof(float));
+  annotated_.resize(delay_count);
+  readBytes(annotated_.data(), delay_count);
+  for (const TimingArc *arc : arc_set->arcs()) {
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count; ap_index++) {
+      bool annotated = annotated_[arc->index() * ap_count + ap_index];
+      // Only touch the annotation when it changes to avoid allocating
+      // annotation sequences for wide edges.
+      if (annotated != graph_->arcDelayAnnotated(edge, arc, ap_index))
+        graph_->setArcDelayAnnotated(edge, arc, ap_index, annotated);
+    }
+  }
+  uint8_t incremental;
+  readBytes(&incremental, sizeof(incremental));
+  edge->setDelayAnnotationIsIncremental(incremental);
+}
+
+void
+Checkpoint::readBytes(void *bytes,
+                      size_t size)
+{
+  if (fread(bytes, 1, size, stream_) != size)
+    mismatch();
+}
+
+// The graph is partially overwritten so the delays have to be found
+// from scratch.
+void
+Checkpoint::mismatch()
+{
+  fclose(stream_);
+  stream_ = nullptr;
+  graph_delay_calc_->delaysInvalid();
+  report_->error(1595, "{} checkpoint does not match the design.", filename_);
+}
+
+} // namespace sta
@@ -0,0 +1,101 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "GraphClass.hh"
+#include "SdcClass.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+// Binary checkpoint of the delay calculation results of a timed design.
+// The graph vertex slews, slew annotations, sdf period check annotations,
+// edge arc delays, arc delay annotations and incremental annotation
+// flags are written in graph order. Reading a checkpoint into the same
+// design with the same scenes restores them without finding delays.
+// The netlist, liberty, parasitics and constraints are not saved; they
+// are read before the checkpoint and have to produce the same graph.
+// The header has a fingerprint of the liberty and parasitics files and
+// the constraints that is checked when the checkpoint is read.
+// Arrivals and requireds are not saved; they are found by the next
+// search from the restored delays.
+class Checkpoint : public StaState
+{
+public:
+  Checkpoint(StaState *sta);
+  void write(std::string_view filename);
+  void read(std::string_view filename);
+
+  static constexpr uint32_t version = 2;
+
+protected:
+  struct Header
+  {
+    char magic[8];
+    uint32_t version;
+    // Floats per delay; 1 for scalar delays.
+    uint32_t delay_float_count;
+    uint64_t ap_count;
+    uint64_t vertex_count;
+    uint64_t edge_count;
+    // Hash of the liberty, parasitics and sdc used to find the delays.
+    uint64_t fingerprint;
+  };
+
+  struct EdgeRecord
+  {
+    uint32_t from_id;
+    uint32_t to_id;
+    uint32_t arc_count;
+  };
+
+  Header makeHeader();
+  uint64_t fingerprint();
+  void hashFile(const std::string &filename,
+                size_t &hash);
+  size_t sdcHash(const Sdc *sdc);
+  void writeBytes(const void *bytes,
+                  size_t size);
+  void readBytes(void *bytes,
+                 size_t size);
+  void readVertex(Vertex *vertex,
+                  size_t slew_float_count);
+  void readEdge(Edge *edge,
+                size_t delay_float_count);
+  void mismatch();
+
+  std::string_view filename_;
+  FILE *stream_{nullptr};
+  std::vector<float> floats_;
+  std::vector<uint8_t> annotated_;
+};
+
+} // namespace sta
@@ -193,14 +193,18 @@ ClkSkews::findClkSkew(ConstClockSeq &clks,
 
   if (thread_count_ > 1) {
     std::vector<ClkSkewMap> partial_skews(thread_count_);
+    VertexSeq src_vertices;
     for (Vertex *src_vertex : graph_->regClkVertices()) {
-      if (hasClkPaths(src_vertex)) {
-        dispatch_queue_->dispatch([this, src_vertex, &partial_skews](size_t i) {
-          findClkSkewFrom(src_vertex, partial_skews[i]);
-        });
-      }
+      if (hasClkPaths(src_vertex))
+        src_vertices.push_back(src_vertex);
     }
-    dispatch_queue_->finishTasks();
+    dispatch_queue_->parallelFor(src_vertices.size(), 0,
+                                 [this, &src_vertices, &partial_skews](size_t thread,
+                                                                       size_t from,
+                                                                       size_t to) {
+      for (size_t i = from; i < to; i++)
+        findClkSkewFrom(src_vertices[i], partial_skews[thread]);
+    });
 
     // Reduce skews from each register source.
     for (auto & i : partial_skews) {
@@ -26,12 +26,19 @@
 
 #include <algorithm>
 #include <cmath> // abs
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "ClkInfo.hh"
 #include "Debug.hh"
 #include "Genclks.hh"
 #include "Graph.hh"
+#include "ClkNetwork.hh"
 #include "Mode.hh"
+#include "Mutex.hh"
 #include "Network.hh"
 #include "Path.hh"
 #include "PathEnd.hh"
@@ -44,11 +51,316 @@
 
 namespace sta {
 
+// Index of the clock paths in the graph used to find the common pin of
+// two clock paths with binary lifting over the clock path prev links.
+// Common pins are only found with the index if every pin on both
+// clock path chains has one fanin clock pin (the clock network is a
+// tree above them). Reconvergent clock networks use the level walk.
+class ClkTreeIndex
+{
+public:
+  ClkTreeIndex(const StaState *sta);
+  // Return false if the paths are not indexed.
+  bool commonPaths(const Path *path1,
+                   const Path *path2,
+                   // Return values.
+                   const Path *&common1,
+                   const Path *&common2) const;
+  // Generated clock source paths of a clock path with a generated clock.
+  const ConstPathSeq *genClkSrcPaths(const Path *path) const;
+
+private:
+  struct ClkTreeNode
+  {
+    const Path *path;
+    const Pin *pin;
+    uint32_t depth;
+    // Index of the first 2^k ancestor in ups_.
+    uint32_t ups_begin;
+    uint32_t up_count;
+    bool is_tree;
+    const ConstPathSeq *gclk_paths;
+  };
+
+  const Path *prevClkPath(const Path *path) const;
+  size_t ensureNode(const Path *path);
+  size_t makeNode(const Path *path,
+                  size_t parent);
+  size_t up(size_t node,
+            size_t k) const;
+  size_t ancestor(size_t node,
+                  uint32_t distance) const;
+  void makeGenClkSrcPaths(const Path *path,
+                          ClkTreeNode &node);
+
+  static constexpr size_t null_node = SIZE_MAX;
+  const StaState *sta_;
+  std::vector<ClkTreeNode> nodes_;
+  std::vector<size_t> ups_;
+  std::unordered_map<const Path*, size_t> node_map_;
+  std::unordered_map<const Pin*, const Pin*> pin_parents_;
+  std::unordered_set<const Pin*> reconvergent_pins_;
+  std::vector<std::unique_ptr<ConstPathSeq>> gclk_paths_;
+};
+
+ClkTreeIndex::ClkTreeIndex(const StaState *sta) :
+  sta_(sta)
+{
+  const Graph *graph = sta->graph();
+  for (const Mode *mode : sta->modes()) {
+    ClkNetwork *clk_network = mode->clkNetwork();
+    for (const Clock *clk : mode->sdc()->clocks()) {
+      const PinSet *clk_pins = clk_network->pins(clk);
+      if (clk_pins) {
+        for (const Pin *pin : *clk_pins) {
+          Vertex *vertex, *bidirect_drvr_vertex;
+          graph->pinVertices(pin, vertex, bidirect_drvr_vertex);
+          for (Vertex *vertex1 : {vertex, bidirect_drvr_vertex}) {
+            if (vertex1) {
+              VertexPathIterator path_iter(vertex1, sta);
+              while (path_iter.hasNext()) {
+                const Path *path = path_iter.next();
+                if (path->isClock(sta))
+                  ensureNode(path);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  // Parents are always made before their children.
+  for (ClkTreeNode &node : nodes_) {
+    node.is_tree = !reconvergent_pins_.contains(node.pin)
+      && (node.up_count == 0
+          || nodes_[ups_[node.ups_begin]].is_tree);
+  }
+}
+
+const Path *
+ClkTreeIndex::prevClkPath(const Path *path) const
+{
+  const Path *prev = path->prevPath(sta_);
+  if (prev && !prev->isNull())
+    return prev;
+  return nullptr;
+}
+
+size_t
+ClkTreeIndex::ensureNode(const Path *path)
+{
+  std::vector<const Path*> chain;
+  size_t parent = null_node;
+  while (path) {
+    auto itr = node_map_.find(path);
+    if (itr != node_map_.end()) {
+      parent = itr->second;
+      break;
+    }
+    chain.push_back(path);
+    path = prevClkPath(path);
+  }
+  for (auto itr = chain.rbegin(); itr != chain.rend(); itr++)
+    parent = makeNode(*itr, parent);
+  return parent;
+}
+
+size_t
+ClkTreeIndex::makeNode(const Path *path,
+                       size_t parent)
+{
+  size_t index = nodes_.size();
+  ClkTreeNode node;
+  node.path = path;
+  node.pin = path->pin(sta_);
+  node.ups_begin = ups_.size();
+  node.up_count = 0;
+  node.is_tree = false;
+  node.gclk_paths = nullptr;
+  if (parent == null_node)
+    node.depth = 0;
+  else {
+    node.depth = nodes_[parent].depth + 1;
+    // up[k + 1] = up[k].up[k]
+    size_t up1 = parent;
+    while (true) {
+      ups_.push_back(up1);
+      node.up_count++;
+      const ClkTreeNode &up_node = nodes_[up1];
+      if (node.up_count > up_node.up_count)
+        break;
+      up1 = ups_[up_node.ups_begin + node.up_count - 1];
+    }
+  }
+  const Pin *parent_pin = (parent == null_node) ? nullptr : nodes_[parent].pin;
+  auto [itr, inserted] = pin_parents_.emplace(node.pin, parent_pin);
+  if (!inserted && itr->second != parent_pin)
+    reconvergent_pins_.insert(node.pin);
+  makeGenClkSrcPaths(path, node);
+  nodes_.push_back(node);
+  node_map_[path] = index;
+  return index;
+}
+
+void
+ClkTreeIndex::makeGenClkSrcPaths(const Path *path,
+                                 ClkTreeNode &node)
+{
+  const ClkInfo *clk_info = path->clkInfo(sta_);
+  const ClockEdge *clk_edge = clk_info->clkEdge();
+  if (clk_edge && clk_edge->clock()->isGenerated()) {
+    const Pin *clk_src = clk_info->clkSrc();
+    const MinMax *min_max = path->minMax(sta_);
+    Genclks *genclks = path->mode(sta_)->genclks();
+    ConstPathSeq *gclk_paths = new ConstPathSeq;
+    gclk_paths->push_back(path);
+    while (clk_edge->clock()->isGenerated()) {
+      const Path *genclk_path = genclks->srcPath(clk_edge, clk_src, min_max);
+      if (genclk_path == nullptr)
+        break;
+      clk_info = genclk_path->clkInfo(sta_);
+      clk_src = clk_info->clkSrc();
+      clk_edge = clk_info->clkEdge();
+      gclk_paths->push_back(genclk_path);
+    }
+    gclk_paths_.emplace_back(gclk_paths);
+    node.gclk_paths = gclk_paths;
+  }
+}
+
+size_t
+ClkTreeIndex::up(size_t node,
+                 size_t k) const
+{
+  return ups_[nodes_[node].ups_begin + k];
+}
+
+size_t
+ClkTreeIndex::ancestor(size_t node,
+                       uint32_t distance) const
+{
+  for (size_t k = 0; distance; k++, distance >>= 1) {
+    if (distance & 1)
+      node = up(node, k);
+  }
+  return node;
+}
+
+bool
+ClkTreeIndex::commonPaths(const Path *path1,
+                          const Path *path2,
+                          // Return values.
+                          const Path *&common1,
+                          const Path *&common2) const
+{
+  auto itr1 = node_map_.find(path1);
+  auto itr2 = node_map_.find(path2);
+  if (itr1 == node_map_.end()
+      || itr2 == node_map_.end())
+    return false;
+  size_t node1 = itr1->second;
+  size_t node2 = itr2->second;
+  if (!nodes_[node1].is_tree
+      || !nodes_[node2].is_tree)
+    return false;
+
+  // Back up the deeper path to the depth of the other one.
+  uint32_t depth1 = nodes_[node1].depth;
+  uint32_t depth2 = nodes_[node2].depth;
+  if (depth1 > depth2)
+    node1 = ancestor(node1, depth1 - depth2);
+  else if (depth2 > depth1)
+    node2 = ancestor(node2, depth2 - depth1);
+  if (nodes_[node1].pin != nodes_[node2].pin) {
+    // Nodes at the same depth have the same number of ancestors.
+    for (size_t k = nodes_[node1].up_count; k > 0; k--) {
+      if (k - 1 < nodes_[node1].up_count) {
+        size_t up1 = up(node1, k - 1);
+        size_t up2 = up(node2, k - 1);
+        if (nodes_[up1].pin != nodes_[up2].pin) {
+          node1 = up1;
+          node2 = up2;
+        }
+      }
+    }
+    if (nodes_[node1].up_count == 0) {
+      // Different clock tree roots.
+      common1 = nullptr;
+      common2 = nullptr;
+      return true;
+    }
+    node1 = up(node1, 0);
+    node2 = up(node2, 0);
+  }
+  common1 = nodes_[node1].path;
+  common2 = nodes_[node2].path;
+  return true;
+}
+
+const ConstPathSeq *
+ClkTreeIndex::genClkSrcPaths(const Path *path) const
+{
+  auto itr = node_map_.find(path);
+  if (itr != node_map_.end())
+    return nodes_[itr->second].gclk_paths;
+  return nullptr;
+}
+
+////////////////////////////////////////////////////////////////
+
 CheckCrpr::CheckCrpr(StaState *sta) :
   StaState(sta)
 {
 }
 
+CheckCrpr::~CheckCrpr()
+{
+  delete clk_tree_index_.load();
+}
+
+void
+CheckCrpr::searchBefore()
+{
+  clkTreeIndexInvalid();
+  clk_tree_index_enabled_ = false;
+}
+
+void
+CheckCrpr::searchAfter()
+{
+  clk_tree_index_enabled_ = true;
+}
+
+void
+CheckCrpr::clkTreeIndexInvalid()
+{
+  delete clk_tree_index_.exchange(nullptr);
+}
+
+void
+CheckCrpr::setUseClkTreeIndex(bool use)
+{
+  clkTreeIndexInvalid();
+  use_clk_tree_index_ = use;
+}
+
+const ClkTreeIndex *
+CheckCrpr::clkTreeIndex()
+{
+  ClkTreeIndex *index = clk_tree_index_.load(std::memory_order_acquire);
+  if (index == nullptr
+      && clk_tree_index_enabled_
+      && use_clk_tree_index_) {
+    LockGuard lock(clk_tree_index_lock_);
+    index = clk_tree_index_.load(std::memory_order_relaxed);
+    if (index == nullptr) {
+      index = new ClkTreeIndex(this);
+      clk_tree_index_.store(index, std::memory_order_release);
+    }
+  }
+  return index;
+}
+
 // Find the maximum possible crpr (clock min/max delta delay) for a
 // path from it's ClkInfo.
 Arrival
@@ -186,12 +498,17 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
   crpr_pin = nullptr;
   const Path *src_clk_path1 = src_clk_path;
   const Path *tgt_clk_path1 = tgt_clk_path;
+  const ClkTreeIndex *index = clkTreeIndex();
   if (src_clk_path1->clkInfo(this)->clkSrc()
       != tgt_clk_path1->clkInfo(this)->clkSrc()) {
     // Push src/tgt genclk src paths into a vector,
     // The last genclk src path is at index 0.
-    ConstPathSeq src_gclk_paths = genClkSrcPaths(src_clk_path1);
-    ConstPathSeq tgt_gclk_paths = genClkSrcPaths(tgt_clk_path1);
+    ConstPathSeq src_gclk_paths1;
+    ConstPathSeq tgt_gclk_paths1;
+    const ConstPathSeq &src_gclk_paths = genClkSrcPaths(src_clk_path1, index,
+                                                        src_gclk_paths1);
+    const ConstPathSeq &tgt_gclk_paths = genClkSrcPaths(tgt_clk_path1, index,
+                                                        tgt_gclk_paths1);
     // Search from the first gen clk toward the end
     // of the path to find a common root pin.
     int i = src_gclk_paths.size() - 1;
@@ -208,9 +525,38 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
         break;
     }
   }
-  const Path *src_clk_path2 = src_clk_path1;
-  const Path *tgt_clk_path2 = tgt_clk_path1;
-  // src_clk_path2 and tgt_clk_path2 are now in the same (gen)clk src path.
+  // src_clk_path1 and tgt_clk_path1 are now in the same (gen)clk src path.
+  const Path *src_clk_path2;
+  const Path *tgt_clk_path2;
+  findCommonClkPaths(src_clk_path1, tgt_clk_path1, index,
+                     src_clk_path2, tgt_clk_path2);
+  if (src_clk_path2 && !src_clk_path2->isNull()
+      && tgt_clk_path2 && !tgt_clk_path2->isNull()
+      && (src_clk_path2->transition(this) == tgt_clk_path2->transition(this)
+          || same_pin)) {
+    debugPrint(debug_, "crpr", 2, "crpr pin {}",
+               network_->pathName(src_clk_path2->pin(this)));
+    crpr = findCrpr1(src_clk_path2, tgt_clk_path2);
+    crpr_pin = src_clk_path2->pin(this);
+  }
+}
+
+// Find the paths to the common pin of two clock paths.
+void
+CheckCrpr::findCommonClkPaths(const Path *src_clk_path,
+                              const Path *tgt_clk_path,
+                              const ClkTreeIndex *index,
+                              // Return values.
+                              const Path *&src_common_path,
+                              const Path *&tgt_common_path)
+{
+  if (index
+      && index->commonPaths(src_clk_path, tgt_clk_path,
+                            src_common_path, tgt_common_path))
+    return;
+
+  const Path *src_clk_path2 = src_clk_path;
+  const Path *tgt_clk_path2 = tgt_clk_path;
   // Use the vertex levels to back up the deeper path to see if they
   // overlap.
   int src_level = src_clk_path2->vertex(this)->level();
@@ -218,29 +564,36 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
   while (src_clk_path2->pin(this) != tgt_clk_path2->pin(this)) {
     int level_diff = src_level - tgt_level;
     if (level_diff >= 0) {
-      src_clk_path2 = src_clk_path2->prevPath();
+      src_clk_path2 = src_clk_path2->prevPath(this);
       if (src_clk_path2 == nullptr
           || src_clk_path2->isNull())
         break;
       src_level = src_clk_path2->vertex(this)->level();
     }
     if (level_diff <= 0) {
-      tgt_clk_path2 = tgt_clk_path2->prevPath();
+      tgt_clk_path2 = tgt_clk_path2->prevPath(this);
       if (tgt_clk_path2 == nullptr
           || tgt_clk_path2->isNull())
         break;
       tgt_level = tgt_clk_path2->vertex(this)->level();
     }
   }
-  if (src_clk_path2 && !src_clk_path2->isNull()
-      && tgt_clk_path2 && !tgt_clk_path2->isNull()
-      && (src_clk_path2->transition(this) == tgt_clk_path2->transition(this)
-          || same_pin)) {
-    debugPrint(debug_, "crpr", 2, "crpr pin {}",
-               network_->pathName(src_clk_path2->pin(this)));
-    crpr = findCrpr1(src_clk_path2, tgt_clk_path2);
-    crpr_pin = src_clk_path2->pin(this);
+  src_common_path = src_clk_path2;
+  tgt_common_path = tgt_clk_path2;
+}
+
+const ConstPathSeq &
+CheckCrpr::genClkSrcPaths(const Path *path,
+                          const ClkTreeIndex *index,
+                          ConstPathSeq &gclk_paths)
+{
+  if (index) {
+    const ConstPathSeq *index_gclk_paths = index->genClkSrcPaths(path);
+    if (index_gclk_paths)
+      return *index_gclk_paths;
   }
+  gclk_paths = genClkSrcPaths(path);
+  return gclk_paths;
 }
 
 ConstPathSeq
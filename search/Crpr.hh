@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include "Clock.hh"
 #include "Delay.hh"
 #include "NetworkClass.hh"
@@ -35,12 +38,14 @@
 namespace sta {
 
 class CrprPaths;
+class ClkTreeIndex;
 
 // Clock Reconvergence Pessimism Removal.
 class CheckCrpr : public StaState
 {
 public:
   CheckCrpr(StaState *sta);
+  ~CheckCrpr() override;
 
   // Find the maximum possible crpr (clock min/max delta delay) for path.
   Arrival maxCrpr(const ClkInfo *clk_info);
@@ -60,6 +65,13 @@ public:
                        // Return values.
                        Crpr &crpr,
                        Pin *&crpr_pin);
+  // Clock paths are changed by an arrival search between searchBefore
+  // and searchAfter so the clock tree index is not used.
+  void searchBefore();
+  void searchAfter();
+  void clkTreeIndexInvalid();
+  // Use the level walk for every common pin search (for testing).
+  void setUseClkTreeIndex(bool use);
 
 private:
   void clkPathPrev(const Path *path,
@@ -82,6 +94,16 @@ private:
   bool crprPossible(const Clock *clk1,
                     const Clock *clk2);
   ConstPathSeq genClkSrcPaths(const Path *path);
+  const ConstPathSeq &genClkSrcPaths(const Path *path,
+                                     const ClkTreeIndex *index,
+                                     ConstPathSeq &gclk_paths);
+  void findCommonClkPaths(const Path *src_clk_path,
+                          const Path *tgt_clk_path,
+                          const ClkTreeIndex *index,
+                          // Return values.
+                          const Path *&src_common_path,
+                          const Path *&tgt_common_path);
+  const ClkTreeIndex *clkTreeIndex();
   void findCrpr(const Path *src_clk_path,
                 const Path *tgt_clk_path,
                 bool same_pin,
@@ -95,6 +117,12 @@ private:
   Crpr findCrpr1(const Path *src_clk_path,
                  const Path *tgt_clk_path);
   float crprArrivalDiff(const Path *path);
+
+  // Built on the first query after an arrival search.
+  std::atomic<ClkTreeIndex*> clk_tree_index_{nullptr};
+  bool clk_tree_index_enabled_{true};
+  bool use_clk_tree_index_{true};
+  std::mutex clk_tree_index_lock_;
 };
 
 } // namespace sta
@@ -0,0 +1,160 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "FilteredReportCache.hh"
+
+#include "Clock.hh"
+#include "Format.hh"
+#include "ExceptionPath.hh"
+#include "Network.hh"
+#include "Search.hh"
+#include "Transition.hh"
+
+namespace sta {
+
+FilteredReportCache::FilteredReportCache(const StaState *sta) :
+  StaState(sta)
+{
+}
+
+void
+FilteredReportCache::setCapacity(size_t capacity)
+{
+  capacity_ = capacity;
+  while (entries_.size() > capacity_) {
+    entry_map_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
+
+std::string
+FilteredReportCache::queryKey(ExceptionFrom *from,
+                              ExceptionThruSeq *thrus,
+                              ExceptionTo *to,
+                              std::string_view options) const
+{
+  std::string key;
+  if (from)
+    queryKey(from, "-from", key);
+  if (thrus) {
+    // Thru order is significant so it is not normalized.
+    for (ExceptionThru *thru : *thrus)
+      queryKey(thru, "-thru", key);
+  }
+  if (to) {
+    queryKey(to, "-to", key);
+    sta::print(key, " {}", to->endTransition()->index());
+  }
+  key += ' ';
+  key += options;
+  return key;
+}
+
+// Exception point object sets are ordered by id so the key does not
+// depend on the order of the objects in the command.
+void
+FilteredReportCache::queryKey(ExceptionPt *pt,
+                              std::string_view prefix,
+                              // Return value.
+                              std::string &key) const
+{
+  sta::print(key, "{} {}", prefix, pt->transition()->index());
+  if (pt->pins()) {
+    key += " p";
+    for (const Pin *pin : *pt->pins())
+      sta::print(key, " {}", network_->id(pin));
+  }
+  if (pt->clks()) {
+    key += " c";
+    for (const Clock *clk : *pt->clks())
+      sta::print(key, " {}", clk->index());
+  }
+  if (pt->instances()) {
+    key += " i";
+    for (const Instance *inst : *pt->instances())
+      sta::print(key, " {}", network_->id(inst));
+  }
+  if (pt->nets()) {
+    key += " n";
+    for (const Net *net : *pt->nets())
+      sta::print(key, " {}", network_->id(net));
+  }
+  key += ' ';
+}
+
+const std::string *
+FilteredReportCache::find(const std::string &key)
+{
+  checkTimingChanged();
+  auto itr = entry_map_.find(key);
+  if (itr == entry_map_.end()) {
+    miss_count_++;
+    return nullptr;
+  }
+  // Move the entry to the front of the list.
+  entries_.splice(entries_.begin(), entries_, itr->second);
+  hit_count_++;
+  return &itr->second->second;
+}
+
+void
+FilteredReportCache::insert(const std::string &key,
+                            std::string text)
+{
+  if (capacity_ == 0)
+    return;
+  checkTimingChanged();
+  auto itr = entry_map_.find(key);
+  if (itr != entry_map_.end()) {
+    itr->second->second = std::move(text);
+    entries_.splice(entries_.begin(), entries_, itr->second);
+  }
+  else {
+    if (entries_.size() >= capacity_) {
+      entry_map_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+    entries_.emplace_front(key, std::move(text));
+    entry_map_[key] = entries_.begin();
+  }
+}
+
+void
+FilteredReportCache::clear()
+{
+  entries_.clear();
+  entry_map_.clear();
+}
+
+void
+FilteredReportCache::checkTimingChanged()
+{
+  size_t timing_change_count = search_->timingChangeCount();
+  if (timing_change_count != timing_change_count_) {
+    clear();
+    timing_change_count_ = timing_change_count;
+  }
+}
+
+} // namespace sta
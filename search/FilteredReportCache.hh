@@ -0,0 +1,81 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "SdcClass.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+// Least recently used cache of report_checks text for -from/-through/-to
+// queries. The path ends of a filtered search point to arrivals that
+// are deleted by the next search, so the report text is saved instead
+// of the path ends. The cache is cleared when the search timing change
+// count changes.
+class FilteredReportCache : public StaState
+{
+public:
+  FilteredReportCache(const StaState *sta);
+  size_t capacity() const { return capacity_; }
+  // Zero capacity disables the cache.
+  void setCapacity(size_t capacity);
+  // Key for from/thrus/to with the objects in id order followed by options.
+  std::string queryKey(ExceptionFrom *from,
+                       ExceptionThruSeq *thrus,
+                       ExceptionTo *to,
+                       std::string_view options) const;
+  // Return nullptr if the key is missing or timing changed since it was saved.
+  const std::string *find(const std::string &key);
+  void insert(const std::string &key,
+              std::string text);
+  void clear();
+  size_t hitCount() const { return hit_count_; }
+  size_t missCount() const { return miss_count_; }
+
+protected:
+  void checkTimingChanged();
+  void queryKey(ExceptionPt *pt,
+                std::string_view prefix,
+                // Return value.
+                std::string &key) const;
+
+  using Entry = std::pair<std::string, std::string>;
+  using EntryList = std::list<Entry>;
+
+  size_t capacity_{0};
+  // Most recently used entry first.
+  EntryList entries_;
+  std::unordered_map<std::string, EntryList::iterator> entry_map_;
+  size_t timing_change_count_{0};
+  size_t hit_count_{0};
+  size_t miss_count_{0};
+};
+
+} // namespace sta
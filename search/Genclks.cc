@@ -104,7 +104,9 @@ Genclks::Genclks(const Mode *mode,
 Genclks::~Genclks()
 {
   deleteContents(genclk_info_map_);
-  clearSrcPaths();
+  // The search may already be deleted, so the paths are not released.
+  for (auto &[vertex, paths] : vertex_src_paths_map_)
+    deleteContents(paths);
 }
 
 void
@@ -798,13 +800,13 @@ Genclks::copyGenClkSrcPaths(Vertex *vertex,
 {
   auto itr = vertex_src_paths_map_.find(vertex);
   if (itr != vertex_src_paths_map_.end()) {
-    const std::vector<const Path *> &src_paths = itr->second;
+    const std::vector<EnumPath*> &src_paths = itr->second;
     for (const Path *path : src_paths) {
       Path src_path = *path;
-      Path *prev_path = src_path.prevPath();
+      Path *prev_path = src_path.prevPath(this);
       if (prev_path && !prev_path->isNull()) {
         Path *prev_vpath = Path::vertexPath(prev_path, this);
-        src_path.setPrevPath(prev_vpath);
+        src_path.setPrevPath(prev_vpath, this);
       }
       debugPrint(debug_, "genclk", 3, "vertex {} insert genclk {} src path {} {}s",
                  src_path.vertex(this)->to_string(this),
@@ -821,9 +823,11 @@ Genclks::copyGenClkSrcPaths(Vertex *vertex,
 void
 Genclks::clearSrcPaths()
 {
-  for (const auto& [vertex, paths] : vertex_src_paths_map_) {
-    for (const Path *path : paths)
+  for (const auto &[vertex, paths] : vertex_src_paths_map_) {
+    for (EnumPath *path : paths) {
+      search_->releaseEnumPath(path);
       delete path;
+    }
   }
   vertex_src_paths_map_.clear();
   genclk_src_paths_.clear();
@@ -878,16 +882,17 @@ Genclks::recordSrcPaths(Clock *gclk)
       Path &src_path = src_paths[path_index];
       if (!src_path.isNull()) {
         Path *prev_copy = &src_path;
-        const Path *p = src_path.prevPath();
+        const Path *p = src_path.prevPath(this);
         while (p) {
-          Path *copy = new Path(p);
+          EnumPath *copy = new EnumPath(p);
           copy->setIsEnum(true);
-          prev_copy->setPrevPath(copy);
+          search_->saveEnumPath(copy, false);
+          prev_copy->setPrevPath(copy, this);
           prev_copy = copy;
 
           Vertex *vertex = p->vertex(this);
           vertex_src_paths_map_[vertex].push_back(copy);
-          p = p->prevPath();
+          p = p->prevPath(this);
         }
         found_src_paths = true;
       }
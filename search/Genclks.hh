@@ -57,7 +57,7 @@ public:
 
 using GenclkInfoMap = std::map<Clock*, GenclkInfo*>;
 using GenclkSrcPathMap = std::map<ClockPinPair, std::vector<Path>, ClockPinPairLess>;
-using VertexGenclkSrcPathsMap = std::map<Vertex*, std::vector<const Path*>, VertexIdLess>;
+using VertexGenclkSrcPathsMap = std::map<Vertex*, std::vector<EnumPath*>, VertexIdLess>;
 using VertexQueue = std::queue<Vertex*>;
 
 class Genclks : public StaState
@@ -25,17 +25,19 @@
 #include "Levelize.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
-#include <deque>
 
 #include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Graph.hh"
 #include "GraphCmp.hh"
 #include "GraphDelayCalc.hh"
 #include "Mode.hh"
 #include "Network.hh"
 #include "PortDirection.hh"
+#include "Profiler.hh"
 #include "Report.hh"
 #include "Sdc.hh"
 #include "Stats.hh"
@@ -112,6 +114,7 @@ void
 Levelize::findLevels()
 {
   Stats stats(debug_, report_);
+  ProfileScope profile("levelize");
   debugPrint(debug_, "levelize", 1, "levelize");
   clear();
   if (observer_)
@@ -120,31 +123,28 @@ Levelize::findLevels()
   for (const Mode *mode : modes_)
     mode->sdc()->ensureInputDelayRefPinEdges();
 
+  VertexSeq vertices;
   VertexIterator vertex_iter(graph_);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    // findBackEdges() init
-    vertex->setVisited(false);
-    vertex->setOnPath(false);
-    // assignLevels init
-    vertex->setLevel(-1);
-  }
+  while (vertex_iter.hasNext())
+    vertices.push_back(vertex_iter.next());
+
+  auto init_vertices = [&] (size_t, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      Vertex *vertex = vertices[i];
+      // findBackEdges() init
+      vertex->setVisited(false);
+      vertex->setOnPath(false);
+    }
+  };
+  if (thread_count_ > 1 && vertices.size() >= levelize_thread_min_count)
+    dispatch_queue_->parallelFor(vertices.size(), 0, init_vertices);
+  else
+    init_vertices(0, 0, vertices.size());
+
+  findRoots(vertices);
+  findBackEdges(vertices);
+  assignLevels(vertices);
 
-  findRoots();
-  findBackEdges();
-  VertexSeq topo_sorted = findTopologicalOrder();
-  assignLevels(topo_sorted);
-
-  // Set level of stranded vertices (constants) to zero.
-  VertexIterator vertex_iter2(graph_);
-  while (vertex_iter2.hasNext()) {
-    Vertex *vertex = vertex_iter2.next();
-    if (vertex->level() == -1)
-      setLevel(vertex, 0);
-    // cleanup
-    vertex->setVisited(false);
-    vertex->setOnPath(false);
-  }
   relevelize_from_.clear();
   levelized_ = true;
   levels_valid_ = true;
@@ -152,16 +152,26 @@ Levelize::findLevels()
 }
 
 void
-Levelize::findRoots()
+Levelize::findRoots(const VertexSeq &vertices)
 {
   roots_.clear();
-  VertexIterator vertex_iter(graph_);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    if (isRoot(vertex)) {
-      debugPrint(debug_, "levelize", 2, "root {}{}", vertex->to_string(this),
-                 hasFanout(vertex) ? " fanout" : "");
-      roots_.insert(vertex);
+  std::vector<VertexSeq> thread_roots(thread_count_);
+  auto find_roots = [&] (size_t thread, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      Vertex *vertex = vertices[i];
+      if (isRoot(vertex))
+        thread_roots[thread].push_back(vertex);
+    }
+  };
+  if (thread_count_ > 1 && vertices.size() >= levelize_thread_min_count)
+    dispatch_queue_->parallelFor(vertices.size(), 0, find_roots);
+  else
+    find_roots(0, 0, vertices.size());
+  for (const VertexSeq &roots : thread_roots) {
+    for (Vertex *root : roots) {
+      debugPrint(debug_, "levelize", 2, "root {}{}", root->to_string(this),
+                 hasFanout(root) ? " fanout" : "");
+      roots_.insert(root);
     }
   }
   if (debug_->check("levelize", 1)) {
@@ -222,10 +232,17 @@ Levelize::hasFanout(Vertex *vertex)
 }
 
 // Non-recursive DFS to find back edges so the graph is acyclic.
+// The DFS is skipped if a parallel topological sort visits every
+// vertex because it would not find any back edges.
 void
-Levelize::findBackEdges()
+Levelize::findBackEdges(const VertexSeq &vertices)
 {
   Stats stats(debug_, report_);
+  if (isAcyclic(vertices)) {
+    debugPrint(debug_, "levelize", 1, "graph is acyclic");
+    stats.report("Levelize find back edges");
+    return;
+  }
   EdgeSeq path;
   FindBackEdgesStack stack;
 
@@ -338,82 +355,134 @@ Levelize::findUnvisitedVertices()
 
 ////////////////////////////////////////////////////////////////
 
-VertexSeq
-Levelize::findTopologicalOrder()
-{
-  Stats stats(debug_, report_);
-  std::map<Vertex *, int> in_degree;
-
-  VertexIterator vertex_iter(graph_);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    VertexOutEdgeIterator edge_iter(vertex, graph_);
-    while (edge_iter.hasNext()) {
-      Edge *edge = edge_iter.next();
-      Vertex *to_vertex = edge->to(graph_);
-      if (searchThru(edge))
-        in_degree[to_vertex] += 1;
-    }
-    // Levelize bidirect driver as if it was a fanout of the bidirect load.
-    const Pin *pin = vertex->pin();
-    if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
-        && !vertex->isBidirectDriver()) {
-      Vertex *to_vertex = graph_->pinDrvrVertex(pin);
-      ;
-      in_degree[to_vertex] += 1;
-    }
+// The DFS only follows graph edges so the bidirect driver fanout is
+// not included.
+bool
+Levelize::isAcyclic(const VertexSeq &vertices)
+{
+  VertexInDegrees in_degrees(graph_->vertexIdBound());
+  findInDegrees(vertices, false, in_degrees);
+  VertexSeq frontier;
+  for (Vertex *vertex : vertices) {
+    if (in_degrees[graph_->id(vertex)] == 0)
+      frontier.push_back(vertex);
   }
+  size_t visit_count = visitTopological(frontier, false, in_degrees, nullptr);
+  return visit_count == vertices.size();
+}
 
-  std::deque<Vertex *> queue;
-  for (Vertex *root : roots_)
-    queue.push_back(root);
-
-  VertexSeq topo_order;
-  while (!queue.empty()) {
-    Vertex *vertex = queue.front();
-    queue.pop_front();
-    topo_order.push_back(vertex);
-    VertexOutEdgeIterator edge_iter(vertex, graph_);
-    while (edge_iter.hasNext()) {
-      Edge *edge = edge_iter.next();
-      Vertex *to_vertex = edge->to(graph_);
-      if (searchThru(edge)) {
-        const auto &to_degree_itr = in_degree.find(to_vertex);
-        int &to_in_degree = to_degree_itr->second;
-        to_in_degree -= 1;
-        if (to_in_degree == 0)
-          queue.push_back(to_vertex);
+void
+Levelize::findInDegrees(const VertexSeq &vertices,
+                        bool bidirect_fanout,
+                        // Return value.
+                        VertexInDegrees &in_degrees)
+{
+  auto count_in_degrees = [&] (size_t, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+      Vertex *vertex = vertices[i];
+      VertexOutEdgeIterator edge_iter(vertex, graph_);
+      while (edge_iter.hasNext()) {
+        Edge *edge = edge_iter.next();
+        if (searchThru(edge))
+          in_degrees[edge->to()].fetch_add(1, std::memory_order_relaxed);
+      }
+      if (bidirect_fanout) {
+        Vertex *to_vertex = bidirectFanout(vertex);
+        if (to_vertex)
+          in_degrees[graph_->id(to_vertex)].fetch_add(1, std::memory_order_relaxed);
       }
     }
-    // Levelize bidirect driver as if it was a fanout of the bidirect load.
-    const Pin *pin = vertex->pin();
-    if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
-        && !vertex->isBidirectDriver()) {
-      Vertex *to_vertex = graph_->pinDrvrVertex(pin);
-      const auto &degree_itr = in_degree.find(to_vertex);
-      int &in_degree = degree_itr->second;
-      in_degree -= 1;
-      if (in_degree == 0)
-        queue.push_back(to_vertex);
-    }
-  }
+  };
+  if (thread_count_ > 1 && vertices.size() >= levelize_thread_min_count)
+    dispatch_queue_->parallelFor(vertices.size(), 0, count_in_degrees);
+  else
+    count_in_degrees(0, 0, vertices.size());
+}
 
-  if (debug_->check("levelize", 1)) {
-    VertexIterator vertex_iter(graph_);
-    while (vertex_iter.hasNext()) {
-      Vertex *vertex = vertex_iter.next();
-      if (in_degree[vertex] != 0)
-        debugPrint(debug_, "levelize", 2, "topological sort missing {}",
-                   vertex->to_string(this));
+// Levelize bidirect driver as if it was a fanout of the bidirect load.
+Vertex *
+Levelize::bidirectFanout(Vertex *vertex) const
+{
+  const Pin *pin = vertex->pin();
+  if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
+      && !vertex->isBidirectDriver())
+    return graph_->pinDrvrVertex(pin);
+  else
+    return nullptr;
+}
+
+// Kahn's topological sort with the frontier of vertices with no
+// unvisited fanin visited in parallel. When levels is not null the
+// fanout levels are set to the max of the fanin levels plus the level space.
+// Returns the number of vertices visited.
+size_t
+Levelize::visitTopological(VertexSeq &frontier,
+                           bool bidirect_fanout,
+                           VertexInDegrees &in_degrees,
+                           VertexLevels *levels)
+{
+  size_t visit_count = 0;
+  std::vector<VertexSeq> thread_frontiers(thread_count_);
+  while (!frontier.empty()) {
+    if (debug_->check("levelize", 3)) {
+      for (Vertex *vertex : frontier)
+        report_->report("{}", vertex->to_string(this));
+    }
+    visit_count += frontier.size();
+    auto visit_frontier = [&] (size_t thread, size_t from, size_t to) {
+      VertexSeq &next_frontier = thread_frontiers[thread];
+      for (size_t i = from; i < to; i++) {
+        Vertex *vertex = frontier[i];
+        Level to_level = levels
+          ? (*levels)[graph_->id(vertex)].load(std::memory_order_relaxed)
+            + level_space_
+          : 0;
+        VertexOutEdgeIterator edge_iter(vertex, graph_);
+        while (edge_iter.hasNext()) {
+          Edge *edge = edge_iter.next();
+          if (searchThru(edge))
+            visitFanout(edge->to(graph_), to_level, in_degrees, levels,
+                        next_frontier);
+        }
+        if (bidirect_fanout) {
+          Vertex *to_vertex = bidirectFanout(vertex);
+          if (to_vertex)
+            visitFanout(to_vertex, to_level, in_degrees, levels, next_frontier);
+        }
+      }
+    };
+    if (thread_count_ > 1 && frontier.size() >= levelize_thread_min_count)
+      dispatch_queue_->parallelFor(frontier.size(), 0, visit_frontier);
+    else
+      visit_frontier(0, 0, frontier.size());
+    frontier.clear();
+    for (VertexSeq &next_frontier : thread_frontiers) {
+      frontier.insert(frontier.end(), next_frontier.begin(), next_frontier.end());
+      next_frontier.clear();
     }
   }
-  if (debug_->check("levelize", 3)) {
-    report_->report("Topological sort");
-    for (Vertex *vertex : topo_order)
-      report_->report("{}", vertex->to_string(this));
+  return visit_count;
+}
+
+void
+Levelize::visitFanout(Vertex *to_vertex,
+                      Level to_level,
+                      VertexInDegrees &in_degrees,
+                      VertexLevels *levels,
+                      // Return value.
+                      VertexSeq &next_frontier)
+{
+  VertexId to_id = graph_->id(to_vertex);
+  if (levels) {
+    std::atomic<Level> &level = (*levels)[to_id];
+    Level prev_level = level.load(std::memory_order_relaxed);
+    while (prev_level < to_level
+           && !level.compare_exchange_weak(prev_level, to_level,
+                                           std::memory_order_relaxed))
+      ;
   }
-  stats.report("Levelize topological sort");
-  return topo_order;
+  if (in_degrees[to_id].fetch_sub(1, std::memory_order_relaxed) == 1)
+    next_frontier.push_back(to_vertex);
 }
 
 void
@@ -475,47 +544,74 @@ Levelize::reportPath(EdgeSeq &path) const
 
 ////////////////////////////////////////////////////////////////
 
+// Vertex levels are the longest path from the roots.
 void
-Levelize::assignLevels(VertexSeq &topo_sorted)
+Levelize::assignLevels(const VertexSeq &vertices)
 {
-  for (Vertex *root : roots_)
-    setLevel(root, 0);
-  for (Vertex *vertex : topo_sorted) {
-    if (vertex->level() != -1) {
-      VertexOutEdgeIterator edge_iter(vertex, graph_);
-      while (edge_iter.hasNext()) {
-        Edge *edge = edge_iter.next();
-        Vertex *to_vertex = edge->to(graph_);
-        if (searchThru(edge))
-          setLevel(to_vertex,
-                   std::max(to_vertex->level(), vertex->level() + level_space_));
-      }
-      // Levelize bidirect driver as if it was a fanout of the bidirect load.
-      const Pin *pin = vertex->pin();
-      if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
-          && !vertex->isBidirectDriver()) {
-        Vertex *to_vertex = graph_->pinDrvrVertex(pin);
-        setLevel(to_vertex,
-                 std::max(to_vertex->level(), vertex->level() + level_space_));
-      }
-    }
+  Stats stats(debug_, report_);
+  VertexId vertex_id_bound = graph_->vertexIdBound();
+  VertexInDegrees in_degrees(vertex_id_bound);
+  findInDegrees(vertices, true, in_degrees);
+  VertexLevels levels(vertex_id_bound);
+  auto init_levels = [&] (size_t, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++)
+      levels[i].store(-1, std::memory_order_relaxed);
+  };
+  if (thread_count_ > 1 && levels.size() >= levelize_thread_min_count)
+    dispatch_queue_->parallelFor(levels.size(), 0, init_levels);
+  else
+    init_levels(0, 0, levels.size());
+  VertexSeq frontier;
+  for (Vertex *root : roots_) {
+    levels[graph_->id(root)].store(0, std::memory_order_relaxed);
+    frontier.push_back(root);
   }
-}
+  if (debug_->check("levelize", 3))
+    report_->report("Topological sort");
+  visitTopological(frontier, true, in_degrees, &levels);
 
-////////////////////////////////////////////////////////////////
+  if (debug_->check("levelize", 1)) {
+    for (Vertex *vertex : vertices) {
+      if (in_degrees[graph_->id(vertex)] != 0)
+        debugPrint(debug_, "levelize", 2, "topological sort missing {}",
+                   vertex->to_string(this));
+    }
+  }
 
-void
-Levelize::setLevel(Vertex *vertex,
-                   Level level)
-{
-  debugPrint(debug_, "levelize", 3, "set level {} {}",
-             vertex->to_string(this), level);
-  vertex->setLevel(level);
-  max_level_ = std::max(level, max_level_);
-  if (level >= Graph::vertex_level_max)
+  std::vector<Level> thread_max_levels(thread_count_, 0);
+  auto set_levels = [&] (size_t thread, size_t from, size_t to) {
+    Level &max_level = thread_max_levels[thread];
+    for (size_t i = from; i < to; i++) {
+      Vertex *vertex = vertices[i];
+      Level level = levels[graph_->id(vertex)].load(std::memory_order_relaxed);
+      // Set level of stranded vertices (constants) to zero.
+      if (level == -1)
+        level = 0;
+      vertex->setLevel(level);
+      max_level = std::max(level, max_level);
+      // cleanup
+      vertex->setVisited(false);
+      vertex->setOnPath(false);
+    }
+  };
+  if (thread_count_ > 1 && vertices.size() >= levelize_thread_min_count)
+    dispatch_queue_->parallelFor(vertices.size(), 0, set_levels);
+  else
+    set_levels(0, 0, vertices.size());
+  for (Level level : thread_max_levels)
+    max_level_ = std::max(level, max_level_);
+  if (debug_->check("levelize", 3)) {
+    for (Vertex *vertex : vertices)
+      debugPrint(debug_, "levelize", 3, "set level {} {}",
+                 vertex->to_string(this), vertex->level());
+  }
+  if (max_level_ >= Graph::vertex_level_max)
     report_->critical(616, "maximum logic level exceeded");
+  stats.report("Levelize assign levels");
 }
 
+////////////////////////////////////////////////////////////////
+
 void
 Levelize::invalid()
 {
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <stack>
 #include <utility>
 #include <vector>
@@ -40,6 +41,9 @@ class GraphLoop;
 using VertexEdgeIterPair = std::pair<Vertex*,VertexOutEdgeIterator*>;
 using FindBackEdgesStack = std::stack<VertexEdgeIterPair>;
 using GraphLoopSeq = std::vector<GraphLoop*>;
+// Indexed by VertexId.
+using VertexInDegrees = std::vector<std::atomic<int>>;
+using VertexLevels = std::vector<std::atomic<Level>>;
 
 class Levelize : public StaState
 {
@@ -75,15 +79,30 @@ public:
   void findLevels();
 
 protected:
-  void findRoots();
+  void findRoots(const VertexSeq &vertices);
   VertexSeq sortedRootsWithFanout();
-  VertexSeq findTopologicalOrder();
-  void assignLevels(VertexSeq &topo_sorted);
+  bool isAcyclic(const VertexSeq &vertices);
+  void findInDegrees(const VertexSeq &vertices,
+                     bool bidirect_fanout,
+                     // Return value.
+                     VertexInDegrees &in_degrees);
+  Vertex *bidirectFanout(Vertex *vertex) const;
+  size_t visitTopological(VertexSeq &frontier,
+                          bool bidirect_fanout,
+                          VertexInDegrees &in_degrees,
+                          VertexLevels *levels);
+  void visitFanout(Vertex *to_vertex,
+                   Level to_level,
+                   VertexInDegrees &in_degrees,
+                   VertexLevels *levels,
+                   // Return value.
+                   VertexSeq &next_frontier);
+  void assignLevels(const VertexSeq &vertices);
   void recordLoop(Edge *edge,
                   EdgeSeq &path);
   EdgeSeq *loopEdges(EdgeSeq &path,
                      Edge *closing_edge);
-  void findBackEdges();
+  void findBackEdges(const VertexSeq &vertices);
   EdgeSet findBackEdges(EdgeSeq &path,
                         FindBackEdgesStack &stack);
   void findCycleBackEdges();
@@ -95,8 +114,6 @@ protected:
              Level level_space,
              VertexSet &path_vertices,
              EdgeSeq &path);
-  void setLevel(Vertex  *vertex,
-                Level level);
   void setLevelIncr(Vertex  *vertex,
                     Level level);
   void clearLoopEdges();
@@ -113,6 +130,9 @@ protected:
   EdgeSet loop_edges_;
   EdgeSet disabled_loop_edges_;
   LevelizeObserver *observer_{nullptr};
+
+  // Vertex count below which levelization runs on one thread.
+  static constexpr size_t levelize_thread_min_count = 10000;
 };
 
 // Loops broken by levelization may not necessarily be combinational.
@@ -32,12 +32,14 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "ArcDelayCalc.hh"
 #include "ClkDelays.hh"
 #include "Clock.hh"
 #include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Delay.hh"
 #include "Graph.hh"
 #include "GraphClass.hh"
@@ -252,6 +254,7 @@ public:
   void visit(PathEnd *path_end) override;
   void setInputRf(const RiseFall *input_rf);
   const ClockEdgeDelays &margins() const { return margins_; }
+  void mergeMargins(const MakeEndTimingArcs &end_visitor);
 
 private:
   const RiseFall *input_rf_{nullptr};
@@ -276,6 +279,28 @@ MakeEndTimingArcs::setInputRf(const RiseFall *input_rf)
   input_rf_ = input_rf;
 }
 
+// Merge the margins found by another (thread) visitor.
+void
+MakeEndTimingArcs::mergeMargins(const MakeEndTimingArcs &end_visitor)
+{
+  for (const auto &[clk_edge, margins] : end_visitor.margins_) {
+    RiseFallMinMax &margins1 = margins_[clk_edge];
+    for (const RiseFall *input_rf : RiseFall::range()) {
+      for (const MinMax *min_max : MinMax::range()) {
+        float margin, margin1;
+        bool exists, exists1;
+        margins.value(input_rf, min_max, margin, exists);
+        if (exists) {
+          margins1.value(input_rf, min_max, margin1, exists1);
+          // Always max margin, even for min/hold checks.
+          margins1.setValue(input_rf, min_max,
+                            exists1 ? std::max(margin, margin1) : margin);
+        }
+      }
+    }
+  }
+}
+
 void
 MakeEndTimingArcs::visit(PathEnd *path_end)
 {
@@ -351,11 +376,7 @@ MakeTimingModel::findTimingFromInput(Port *input_port)
                                                     nullptr, input_rf1, sdc_);
       search_->findFilteredArrivals(from, nullptr, nullptr, false, false);
 
-      end_visitor.setInputRf(input_rf);
-      VertexSeq endpoints = search_->filteredEndpoints();
-      VisitPathEnds visit_ends(sta_);
-      for (Vertex *end : endpoints)
-        visit_ends.visitPathEnds(end, scenes_, MinMaxAll::all(), true, &end_visitor);
+      findEndMargins(input_rf, end_visitor);
       findOutputDelays(input_rf, output_delays);
       search_->deleteFilteredArrivals();
 
@@ -368,6 +389,36 @@ MakeTimingModel::findTimingFromInput(Port *input_port)
   }
 }
 
+void
+MakeTimingModel::findEndMargins(const RiseFall *input_rf,
+                                MakeEndTimingArcs &end_visitor)
+{
+  end_visitor.setInputRf(input_rf);
+  VertexSeq endpoints = search_->filteredEndpoints();
+  if (thread_count_ == 1) {
+    VisitPathEnds visit_ends(sta_);
+    for (Vertex *end : endpoints)
+      visit_ends.visitPathEnds(end, scenes_, MinMaxAll::all(), true, &end_visitor);
+  }
+  else {
+    MakeEndTimingArcs thread_visitor(sta_);
+    thread_visitor.setInputRf(input_rf);
+    std::vector<MakeEndTimingArcs> visitors(thread_count_, thread_visitor);
+    std::vector<VisitPathEnds> visit_ends(thread_count_, VisitPathEnds(sta_));
+    dispatch_queue_->parallelFor(endpoints.size(), 0,
+                                 [this, &endpoints, &visitors,
+                                  &visit_ends](size_t thread,
+                                               size_t from,
+                                               size_t to) {
+      for (size_t i = from; i < to; i++)
+        visit_ends[thread].visitPathEnds(endpoints[i], scenes_, MinMaxAll::all(),
+                                         true, &visitors[thread]);
+    });
+    for (const MakeEndTimingArcs &visitor : visitors)
+      end_visitor.mergeMargins(visitor);
+  }
+}
+
 void
 MakeTimingModel::findOutputDelays(const RiseFall *input_rf,
                                   OutputPinDelays &output_pin_delays)
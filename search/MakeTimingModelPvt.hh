@@ -41,6 +41,7 @@ namespace sta {
 
 class Sta;
 class LibertyBuilder;
+class MakeEndTimingArcs;
 
 class OutputDelays
 {
@@ -81,6 +82,8 @@ private:
                         const MinMax *min_max,
                         TimingSense sense,
                         const ClkDelays &delays);
+  void findEndMargins(const RiseFall *input_rf,
+                      MakeEndTimingArcs &end_visitor);
   void findOutputDelays(const RiseFall *input_rf,
                         OutputPinDelays &output_pin_delays);
   void makeSetupHoldTimingArcs(const Pin *input_pin,
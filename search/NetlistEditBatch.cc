@@ -0,0 +1,115 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "NetlistEditBatch.hh"
+
+#include "Debug.hh"
+#include "GraphDelayCalc.hh"
+#include "Levelize.hh"
+#include "Search.hh"
+
+namespace sta {
+
+NetlistEditBatch::NetlistEditBatch(StaState *sta) :
+  StaState(sta),
+  delay_invalid_(makeVertexSet(this)),
+  arrival_invalid_(makeVertexSet(this)),
+  required_invalid_(makeVertexSet(this)),
+  endpoint_invalid_(makeVertexSet(this)),
+  relevelize_from_(makeVertexSet(this))
+{
+}
+
+void
+NetlistEditBatch::delayInvalid(Vertex *vertex)
+{
+  delay_invalid_.insert(vertex);
+}
+
+void
+NetlistEditBatch::arrivalInvalid(Vertex *vertex)
+{
+  arrival_invalid_.insert(vertex);
+}
+
+void
+NetlistEditBatch::requiredInvalid(Vertex *vertex)
+{
+  required_invalid_.insert(vertex);
+}
+
+void
+NetlistEditBatch::endpointInvalid(Vertex *vertex)
+{
+  endpoint_invalid_.insert(vertex);
+}
+
+void
+NetlistEditBatch::relevelizeFrom(Vertex *vertex)
+{
+  relevelize_from_.insert(vertex);
+}
+
+void
+NetlistEditBatch::deleteVertexBefore(Vertex *vertex)
+{
+  delay_invalid_.erase(vertex);
+  arrival_invalid_.erase(vertex);
+  required_invalid_.erase(vertex);
+  endpoint_invalid_.erase(vertex);
+  relevelize_from_.erase(vertex);
+}
+
+void
+NetlistEditBatch::finish()
+{
+  debugPrint(debug_, "network_edit", 1,
+             "netlist edit batch delays {} arrivals {} requireds {}",
+             delay_invalid_.size(),
+             arrival_invalid_.size(),
+             required_invalid_.size());
+  for (Vertex *vertex : relevelize_from_)
+    levelize_->relevelizeFrom(vertex);
+  for (Vertex *vertex : delay_invalid_)
+    graph_delay_calc_->delayInvalid(vertex);
+  for (Vertex *vertex : arrival_invalid_)
+    search_->arrivalInvalid(vertex);
+  for (Vertex *vertex : required_invalid_)
+    search_->requiredInvalid(vertex);
+  for (Vertex *vertex : endpoint_invalid_)
+    search_->endpointInvalid(vertex);
+  clear();
+}
+
+void
+NetlistEditBatch::clear()
+{
+  relevelize_from_.clear();
+  delay_invalid_.clear();
+  arrival_invalid_.clear();
+  required_invalid_.clear();
+  endpoint_invalid_.clear();
+}
+
+} // namespace sta
@@ -0,0 +1,58 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include "Graph.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+// Graph vertex invalidations made by network edits between
+// Sta::beginNetlistEdit and Sta::endNetlistEdit.
+// Each vertex is invalidated once when the batch is finished instead
+// of once for every edit that touches it.
+class NetlistEditBatch : public StaState
+{
+public:
+  NetlistEditBatch(StaState *sta);
+  void delayInvalid(Vertex *vertex);
+  void arrivalInvalid(Vertex *vertex);
+  void requiredInvalid(Vertex *vertex);
+  void endpointInvalid(Vertex *vertex);
+  void relevelizeFrom(Vertex *vertex);
+  void deleteVertexBefore(Vertex *vertex);
+  // Pass the invalidations on to levelize, delay calculation and search.
+  void finish();
+  void clear();
+
+protected:
+  VertexSet delay_invalid_;
+  VertexSet arrival_invalid_;
+  VertexSet required_invalid_;
+  VertexSet endpoint_invalid_;
+  VertexSet relevelize_from_;
+};
+
+} // namespace sta
@@ -28,6 +28,7 @@
 #include <string>
 
 #include "Clock.hh"
+#include "Debug.hh"
 #include "Delay.hh"
 #include "Format.hh"
 #include "Graph.hh"
@@ -49,36 +50,39 @@
 namespace sta {
 
 Path::Path() :
-  prev_path_(nullptr),
   arrival_(0.0),
   required_(0.0),
   vertex_id_(vertex_id_null),
+  prev_path_idx_(prev_path_idx_null),
   tag_index_(tag_index_null),
   is_enum_(false),
-  prev_arc_idx_(0)
+  prev_arc_idx_(0),
+  prev_path_enum_(false)
 {
 }
 
 Path::Path(const Path *path) :
-  prev_path_(path ? path->prev_path_ : nullptr),
   arrival_(path ? path->arrival_ : delay_zero),
   required_(path ? path->required_ : delay_zero),
   vertex_id_(path ? path->vertex_id_ : vertex_id_null),
+  prev_path_idx_(path ? path->prev_path_idx_ : prev_path_idx_null),
   tag_index_(path ? path->tag_index_ : tag_index_null),
   is_enum_(path ? path->is_enum_ : false),
-  prev_arc_idx_(path ? path->prev_arc_idx_ : 0)
+  prev_arc_idx_(path ? path->prev_arc_idx_ : 0),
+  prev_path_enum_(path ? path->prev_path_enum_ : false)
 {
 }
 
 Path::Path(Vertex *vertex,
            Tag *tag,
            const StaState *sta) :
-  prev_path_(nullptr),
   arrival_(0.0),
   required_(0.0),
+  prev_path_idx_(prev_path_idx_null),
   tag_index_(tag->index()),
   is_enum_(false),
-  prev_arc_idx_(0)
+  prev_arc_idx_(0),
+  prev_path_enum_(false)
 {
   const Graph *graph = sta->graph();
   vertex_id_ = graph->id(vertex);
@@ -91,13 +95,13 @@ Path::Path(Vertex *vertex,
            Edge *prev_edge,
            TimingArc *prev_arc,
            const StaState *sta) :
-  prev_path_(prev_path),
   arrival_(arrival),
   required_(0.0),
   tag_index_(tag->index()),
   is_enum_(false)
 {
   const Graph *graph = sta->graph();
+  setPrevPathIdx(prev_path, prev_edge, sta);
   if (prev_path) {
     prev_edge_id_ = graph->id(prev_edge);
     prev_arc_idx_ = prev_arc->index();
@@ -116,13 +120,13 @@ Path::Path(Vertex *vertex,
            TimingArc *prev_arc,
            bool is_enum,
            const StaState *sta) :
-  prev_path_(prev_path),
   arrival_(arrival),
   required_(0.0),
   tag_index_(tag->index()),
   is_enum_(is_enum)
 {
   const Graph *graph = sta->graph();
+  setPrevPathIdx(prev_path, prev_edge, sta);
   if (prev_path) {
     prev_edge_id_ = graph->id(prev_edge);
     prev_arc_idx_ = prev_arc->index();
@@ -140,7 +144,9 @@ Path::init(Vertex *vertex,
 {
   const Graph *graph = sta->graph();
   vertex_id_ = graph->id(vertex);
-  tag_index_ = tag_index_null, prev_path_ = nullptr;
+  tag_index_ = tag_index_null;
+  prev_path_idx_ = prev_path_idx_null;
+  prev_path_enum_ = false;
   prev_arc_idx_ = 0;
   arrival_ = arrival;
   required_ = 0.0;
@@ -154,7 +160,9 @@ Path::init(Vertex *vertex,
 {
   const Graph *graph = sta->graph();
   vertex_id_ = graph->id(vertex);
-  tag_index_ = tag->index(), prev_path_ = nullptr;
+  tag_index_ = tag->index();
+  prev_path_idx_ = prev_path_idx_null;
+  prev_path_enum_ = false;
   prev_arc_idx_ = 0;
   arrival_ = 0.0;
   required_ = 0.0;
@@ -169,7 +177,9 @@ Path::init(Vertex *vertex,
 {
   const Graph *graph = sta->graph();
   vertex_id_ = graph->id(vertex);
-  tag_index_ = tag->index(), prev_path_ = nullptr;
+  tag_index_ = tag->index();
+  prev_path_idx_ = prev_path_idx_null;
+  prev_path_enum_ = false;
   prev_arc_idx_ = 0;
   arrival_ = arrival;
   required_ = 0.0;
@@ -186,7 +196,8 @@ Path::init(Vertex *vertex,
            const StaState *sta)
 {
   const Graph *graph = sta->graph();
-  tag_index_ = tag->index(), prev_path_ = prev_path;
+  tag_index_ = tag->index();
+  setPrevPathIdx(prev_path, prev_edge, sta);
   if (prev_path) {
     prev_edge_id_ = graph->id(prev_edge);
     prev_arc_idx_ = prev_arc->index();
@@ -224,7 +235,7 @@ Vertex *
 Path::vertex(const StaState *sta) const
 {
   const Graph *graph = sta->graph();
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Edge *edge = graph->edge(prev_edge_id_);
     return edge->to(graph);
   }
@@ -236,7 +247,7 @@ VertexId
 Path::vertexId(const StaState *sta) const
 {
   const Graph *graph = sta->graph();
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Edge *edge = graph->edge(prev_edge_id_);
     return edge->to();
   }
@@ -378,34 +389,120 @@ Path::slack(const StaState *sta) const
 }
 
 Path *
-Path::prevPath() const
+Path::prevPath(const StaState *sta) const
+{
+  if (!hasPrevPath())
+    return nullptr;
+  else if (prev_path_enum_)
+    return sta->search()->enumPath(prev_path_idx_);
+  else {
+    const Graph *graph = sta->graph();
+    const Edge *prev_edge = graph->edge(prev_edge_id_);
+    Vertex *prev_vertex = prev_edge->from(graph);
+    return prev_vertex->paths() + prev_path_idx_;
+  }
+}
+
+void
+Path::setPrevPath(Path *prev_path,
+                  const StaState *sta)
+{
+  if (prev_path && prev_path->is_enum_)
+    setPrevEnumPath(prev_path, sta);
+  else if (prev_path) {
+    prev_path_idx_ = prev_path->pathIndex(sta);
+    prev_path_enum_ = false;
+  }
+  else {
+    prev_path_idx_ = prev_path_idx_null;
+    prev_path_enum_ = false;
+  }
+  if (prev_path && sta->debug()->check("path", 1))
+    checkPrevPathTag(prev_path, prevPath(sta), sta);
+}
+
+// Search paths are always in the prev edge from vertex paths so the
+// prev path vertex does not have to be found from its prev edge.
+void
+Path::setPrevPathIdx(Path *prev_path,
+                     const Edge *prev_edge,
+                     const StaState *sta)
 {
-  return prev_path_;
+  if (prev_path && prev_path->is_enum_)
+    setPrevEnumPath(prev_path, sta);
+  else if (prev_path) {
+    const Graph *graph = sta->graph();
+    const Vertex *prev_vertex = prev_edge->from(graph);
+    prev_path_idx_ = prev_path - prev_vertex->paths();
+    prev_path_enum_ = false;
+  }
+  else {
+    prev_path_idx_ = prev_path_idx_null;
+    prev_path_enum_ = false;
+  }
+  if (prev_path
+      && hasPrevPath()
+      && sta->debug()->check("path", 1)) {
+    // prev_edge_id_ is not set yet when called from the constructors.
+    const Path *prev_path1 = prev_path_enum_
+      ? sta->search()->enumPath(prev_path_idx_)
+      : prev_edge->from(sta->graph())->paths() + prev_path_idx_;
+    checkPrevPathTag(prev_path, prev_path1, sta);
+  }
+}
+
+// An enumerated prev path that is not saved in the search is dropped
+// so the path ends here instead of referencing another path.
+void
+Path::setPrevEnumPath(Path *prev_path,
+                      const StaState *sta)
+{
+  uint32_t index = sta->search()->enumPathIndex(prev_path);
+  if (index == EnumPath::enum_index_null) {
+    debugPrint(sta->debug(), "path", 1, "enumerated prev path {} not saved",
+               prev_path->to_string(sta));
+    prev_path_idx_ = prev_path_idx_null;
+    prev_path_enum_ = false;
+  }
+  else {
+    prev_path_idx_ = index;
+    prev_path_enum_ = true;
+  }
 }
 
+// The path found from the prev path index (prev_path1) should have
+// the tag of the prev path.
 void
-Path::setPrevPath(Path *prev_path)
+Path::checkPrevPathTag(const Path *prev_path,
+                       const Path *prev_path1,
+                       const StaState *sta)
 {
-  prev_path_ = prev_path;
+  if (prev_path1 == nullptr)
+    sta->report()->report("prev path {} not found.", prev_path->to_string(sta));
+  else if (prev_path1->tag_index_ != prev_path->tag_index_)
+    sta->report()->report("prev path {} tag does not match {}.",
+                          prev_path->to_string(sta),
+                          prev_path1->to_string(sta));
 }
 
 void
 Path::clearPrevPath(const StaState *sta)
 {
   // Preserve vertex ID for path when prev edge is no longer valid.
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Graph *graph = sta->graph();
     const Edge *prev_edge = graph->edge(prev_edge_id_);
     vertex_id_ = prev_edge->to();
     prev_arc_idx_ = 0;
   }
-  prev_path_ = nullptr;
+  prev_path_idx_ = prev_path_idx_null;
+  prev_path_enum_ = false;
 }
 
 TimingArc *
 Path::prevArc(const StaState *sta) const
 {
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Graph *graph = sta->graph();
     const Edge *edge = graph->edge(prev_edge_id_);
     TimingArcSet *arc_set = edge->timingArcSet();
@@ -418,7 +515,7 @@ Path::prevArc(const StaState *sta) const
 Edge *
 Path::prevEdge(const StaState *sta) const
 {
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Graph *graph = sta->graph();
     return graph->edge(prev_edge_id_);
   }
@@ -429,7 +526,7 @@ Path::prevEdge(const StaState *sta) const
 Vertex *
 Path::prevVertex(const StaState *sta) const
 {
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Graph *graph = sta->graph();
     return graph->edge(prev_edge_id_)->from(graph);
   }
@@ -454,12 +551,13 @@ Path::setPrevEdgeArc(Edge *prev_edge,
 void
 Path::checkPrevPath(const StaState *sta) const
 {
-  if (prev_path_ && prev_path_->isNull())
+  const Path *prev_path = prevPath(sta);
+  if (prev_path && prev_path->isNull())
     sta->report()->report("path {} prev path is null.", to_string(sta));
-  if (prev_path_ && !prev_path_->isNull()) {
+  if (prev_path && !prev_path->isNull()) {
     Graph *graph = sta->graph();
     Edge *edge = prevEdge(sta);
-    Vertex *prev_vertex = prev_path_->vertex(sta);
+    Vertex *prev_vertex = prev_path->vertex(sta);
     Vertex *prev_edge_vertex = edge->from(graph);
     if (prev_vertex != prev_edge_vertex) {
       Network *network = sta->network();
@@ -686,8 +784,8 @@ Path::cmpAll(const Path *path1,
 
     TimingArc *prev_arc1 = p1->prevArc(sta);
     TimingArc *prev_arc2 = p2->prevArc(sta);
-    p1 = p1->prevPath();
-    p2 = p2->prevPath();
+    p1 = p1->prevPath(sta);
+    p2 = p2->prevPath(sta);
     if (equal(p1, path1, sta))
       // Equivalent latch loops.
       return 0;
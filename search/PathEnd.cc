@@ -1606,7 +1606,7 @@ PathEndDataCheck::clkPath(Path *path,
 {
   Path *p = path;
   while (p) {
-    Path *prev_path = p->prevPath();
+    Path *prev_path = p->prevPath(sta);
     TimingArc *prev_arc = p->prevArc(sta);
 
     if (p->isClock(sta))
@@ -1615,7 +1615,7 @@ PathEndDataCheck::clkPath(Path *path,
       const TimingRole *prev_role = prev_arc->role();
       if (prev_role == TimingRole::regClkToQ()
           || prev_role == TimingRole::latchEnToQ()) {
-        prev_path = p->prevPath();
+        prev_path = p->prevPath(sta);
         return prev_path;
       }
       else if (prev_role == TimingRole::latchDtoQ()) {
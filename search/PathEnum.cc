@@ -229,7 +229,7 @@ PathEnum::reportDiversionPath(Diversion *div)
                     Path::equal(p, after_div, this) ? " <-after diversion" : "");
     if (p != path && network_->isLatchData(p->pin(this)))
       break;
-    p = p->prevPath();
+    p = p->prevPath(this);
   }
 }
 
@@ -555,7 +555,7 @@ PathEnumFaninVisitor::reportDiversion(const Edge *div_edge,
                                                        after_div, div_edge,
                                                        div_arc),
                                   this);
-    Path *div_prev = before_div_->prevPath();
+    Path *div_prev = before_div_->prevPath(this);
     report_->report("path_enum: diversion {} {} {} -> {}", path->to_string(this),
                     path_enum_->cmp_slack_ ? "slack" : "delay",
                     delayAsString(path_delay, this), delayAsString(div_delay, this));
@@ -643,7 +643,7 @@ PathEnum::makeDiversions(PathEnd *path_end,
                          Path *before)
 {
   Path *path = before;
-  Path *prev_path = path->prevPath();
+  Path *prev_path = path->prevPath(this);
   TimingArc *prev_arc = path->prevArc(this);
   PathEnumFaninVisitor fanin_visitor(path_end, path, unique_pins_, unique_edges_,
                                      this);
@@ -658,7 +658,7 @@ PathEnum::makeDiversions(PathEnd *path_end,
     if (prev_role == TimingRole::latchDtoQ() || prev_role == TimingRole::regClkToQ())
       break;
     path = prev_path;
-    prev_path = path->prevPath();
+    prev_path = path->prevPath(this);
     prev_arc = path->prevArc(this);
   }
 }
@@ -683,13 +683,13 @@ PathEnum::makeDivertedPath(Path *path,
   Path *prev_copy = nullptr;
   while (p) {
     // prev_path made in next pass.
-    Path *copy = new Path(p->vertex(this), p->tag(this), p->arrival(),
-                          // Replaced on next pass.
-                          p->prevPath(), p->prevEdge(this), p->prevArc(this),
-                          true, this);
+    EnumPath *copy = new EnumPath(p->vertex(this), p->tag(this), p->arrival(),
+                                  // Replaced on next pass.
+                                  p->prevPath(this), p->prevEdge(this),
+                                  p->prevArc(this), true, this);
     search_->saveEnumPath(copy);
     if (prev_copy)
-      prev_copy->setPrevPath(copy);
+      prev_copy->setPrevPath(copy, this);
     copies.push_back(copy);
 
     if (p == after_div)
@@ -700,7 +700,7 @@ PathEnum::makeDivertedPath(Path *path,
       break;
     if (p == before_div) {
       // Replaced on next pass.
-      copy->setPrevPath(after_div);
+      copy->setPrevPath(after_div, this);
       copy->setPrevEdgeArc(div_edge, div_arc, this);
       // Update the delays forward from before_div to the end of the path.
       updatePathHeadDelays(copies, after_div);
@@ -708,7 +708,7 @@ PathEnum::makeDivertedPath(Path *path,
       found_div = true;
     }
     else
-      p = p->prevPath();
+      p = p->prevPath(this);
 
     prev_copy = copy;
     first = false;
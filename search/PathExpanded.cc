@@ -69,7 +69,7 @@ PathExpanded::expand(const Path *path,
   size_t i = 0;
   bool found_start = false;
   while (p) {
-    const Path *prev_path = p->prevPath();
+    const Path *prev_path = p->prevPath(sta_);
     if (!found_start) {
       if (prev_path) {
         const TimingArc *prev_arc = p->prevArc(sta_);
@@ -117,11 +117,11 @@ PathExpanded::expandGenclk(const Path *clk_path)
       if (src_path) {
         // The head of the genclk src path is already in paths_,
         // so skip past it.
-        Path *prev_path = src_path->prevPath();
+        Path *prev_path = src_path->prevPath(sta_);
         Path *p = prev_path;
         Path *last_path = nullptr;
         while (p) {
-          prev_path = p->prevPath();
+          prev_path = p->prevPath(sta_);
           paths_.push_back(p);
           last_path = p;
           p = prev_path;
@@ -41,6 +41,7 @@
 #include "Mutex.hh"
 #include "PathEnd.hh"
 #include "PathEnum.hh"
+#include "Profiler.hh"
 #include "Scene.hh"
 #include "Sdc.hh"
 #include "Search.hh"
@@ -621,6 +622,7 @@ PathGroups::makePathEnds(ExceptionTo *to,
                          PathEndSeq &path_ends)
 {
   Stats stats(debug_, report_);
+  ProfileScope profile("path groups");
   makeGroupPathEnds(to, group_path_count_, endpoint_path_count_,
                     unique_pins_, unique_edges_, scenes, min_max);
 
@@ -1022,11 +1024,14 @@ PathGroups::makeGroupPathEnds(VertexSet &endpoints,
       visitors(thread_count_,
                MakeEndpointPathEnds(visitor, Scene::sceneSet(scenes),
                                     min_max, this));
-    for (const auto endpoint : endpoints) {
-      dispatch_queue_->dispatch( [endpoint, &visitors](size_t i)
-      { visitors[i].visit(endpoint); } );
-    }
-    dispatch_queue_->finishTasks();
+    VertexSeq endpoint_seq(endpoints.begin(), endpoints.end());
+    dispatch_queue_->parallelFor(endpoint_seq.size(), 0,
+                                 [&endpoint_seq, &visitors](size_t thread,
+                                                            size_t from,
+                                                            size_t to) {
+      for (size_t i = from; i < to; i++)
+        visitors[thread].visit(endpoint_seq[i]);
+    });
   }
 }
 
@@ -0,0 +1,274 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#include "PathReportBinary.hh"
+
+#include <cstring>
+#include <fstream>
+
+#include "Error.hh"
+#include "Format.hh"
+#include "Report.hh"
+
+namespace sta {
+
+PathReportReader::PathReportReader(Report *report) :
+  report_(report),
+  stream_(nullptr)
+{
+}
+
+PathReportReader::~PathReportReader()
+{
+  close();
+}
+
+void
+PathReportReader::open(std::string_view filename)
+{
+  close();
+  filename_ = filename;
+  strings_.clear();
+  stream_ = fopen(filename_.c_str(), "rb");
+  if (stream_ == nullptr)
+    throw FileNotReadable(filename);
+  fseek(stream_, 0, SEEK_END);
+  file_size_ = ftell(stream_);
+  fseek(stream_, 0, SEEK_SET);
+
+  char file_magic[sizeof(magic)];
+  uint32_t file_version;
+  if (fread(file_magic, 1, sizeof(file_magic), stream_) != sizeof(file_magic)
+      || memcmp(file_magic, magic, sizeof(magic)) != 0) {
+    close();
+    report_->error(1608, "{} is not a binary path report.", filename);
+  }
+  readBytes(&file_version, sizeof(file_version));
+  if (file_version != version) {
+    close();
+    report_->error(1609, "{} path report version {} is not supported.",
+                   filename, file_version);
+  }
+}
+
+void
+PathReportReader::close()
+{
+  if (stream_) {
+    fclose(stream_);
+    stream_ = nullptr;
+  }
+}
+
+bool
+PathReportReader::next(PathReportEnd &end,
+                       std::vector<PathReportStage> &stages)
+{
+  while (stream_) {
+    PathReportTag tag;
+    readBytes(&tag, sizeof(tag));
+    switch (tag) {
+    case PathReportTag::string: {
+      uint32_t length;
+      readBytes(&length, sizeof(length));
+      if (length > remaining())
+        corrupted();
+      std::string &str = strings_.emplace_back(length, '\0');
+      readBytes(str.data(), length);
+      break;
+    }
+    case PathReportTag::path_end:
+      readBytes(&end, sizeof(end));
+      if (end.stage_count > remaining() / sizeof(PathReportStage))
+        corrupted();
+      stages.resize(end.stage_count);
+      readBytes(stages.data(), stages.size() * sizeof(PathReportStage));
+      return true;
+    case PathReportTag::end:
+      close();
+      return false;
+    default:
+      corrupted();
+    }
+  }
+  return false;
+}
+
+const std::string &
+PathReportReader::string(uint32_t index) const
+{
+  if (index < strings_.size())
+    return strings_[index];
+  else
+    return empty_;
+}
+
+void
+PathReportReader::readBytes(void *bytes,
+                            size_t size)
+{
+  if (fread(bytes, 1, size, stream_) != size)
+    corrupted();
+}
+
+// Bytes left to read in the file.
+size_t
+PathReportReader::remaining() const
+{
+  long position = ftell(stream_);
+  return (position < 0 || position > file_size_) ? 0 : file_size_ - position;
+}
+
+void
+PathReportReader::corrupted()
+{
+  close();
+  report_->error(1610, "{} path report is corrupted.", filename_);
+}
+
+////////////////////////////////////////////////////////////////
+
+// Names are escaped because escaped verilog names have backslashes.
+static std::string
+jsonString(const PathReportReader &reader,
+           uint32_t index)
+{
+  std::string escaped;
+  for (char ch : reader.string(index)) {
+    switch (ch) {
+    case '"':
+      escaped += "\\\"";
+      break;
+    case '\\':
+      escaped += "\\\\";
+      break;
+    default:
+      if (static_cast<unsigned char>(ch) < 0x20)
+        escaped += sta::format("\\u{:04x}", static_cast<int>(ch));
+      else
+        escaped += ch;
+    }
+  }
+  return escaped;
+}
+
+static const char *
+riseFallName(uint8_t rise)
+{
+  return rise ? "rise" : "fall";
+}
+
+static void
+writeJsonStages(const PathReportReader &reader,
+                const std::vector<PathReportStage> &stages,
+                std::ofstream &stream)
+{
+  sta::print(stream, "  \"source_path\": [\n");
+  for (size_t i = 0; i < stages.size(); i++) {
+    const PathReportStage &stage = stages[i];
+    sta::print(stream, "    {{\n");
+    if (stage.instance != PathReportReader::no_string) {
+      sta::print(stream, "      \"instance\": \"{}\",\n",
+                 jsonString(reader, stage.instance));
+      if (stage.cell != PathReportReader::no_string)
+        sta::print(stream, "      \"cell\": \"{}\",\n",
+                   jsonString(reader, stage.cell));
+    }
+    sta::print(stream, "      \"pin\": \"{}\",\n",
+               jsonString(reader, stage.pin));
+    if (stage.net != PathReportReader::no_string)
+      sta::print(stream, "      \"net\": \"{}\",\n",
+                 jsonString(reader, stage.net));
+    sta::print(stream, "      \"transition\": \"{}\",\n",
+               riseFallName(stage.rise));
+    sta::print(stream, "      \"arrival\": {:.3e},\n", stage.arrival);
+    if (stage.is_driver) {
+      sta::print(stream, "      \"capacitance\": {:.3e},\n",
+                 stage.capacitance);
+      sta::print(stream, "      \"fanout\": {},\n", stage.fanout);
+    }
+    sta::print(stream, "      \"slew\": {:.3e}\n", stage.slew);
+    sta::print(stream, "    }}{}\n", (i < stages.size() - 1) ? "," : "");
+  }
+  sta::print(stream, "  ]");
+}
+
+void
+writePathReportJson(std::string_view filename,
+                    std::string_view json_filename,
+                    Report *report)
+{
+  PathReportReader reader(report);
+  reader.open(filename);
+  std::ofstream stream{std::string(json_filename)};
+  if (!stream.is_open())
+    throw FileNotWritable(json_filename);
+
+  sta::print(stream, "{{\"checks\": [\n");
+  PathReportEnd end;
+  std::vector<PathReportStage> stages;
+  bool first = true;
+  while (reader.next(end, stages)) {
+    if (!first)
+      sta::print(stream, ",\n");
+    first = false;
+    sta::print(stream, "{{\n");
+    sta::print(stream, "  \"type\": \"{}\",\n", jsonString(reader, end.type));
+    sta::print(stream, "  \"path_group\": \"{}\",\n",
+               jsonString(reader, end.path_group));
+    sta::print(stream, "  \"path_type\": \"{}\",\n", end.max ? "max" : "min");
+    sta::print(stream, "  \"startpoint\": \"{}\",\n",
+               jsonString(reader, end.startpoint));
+    sta::print(stream, "  \"endpoint\": \"{}\",\n",
+               jsonString(reader, end.endpoint));
+    if (end.source_clock != PathReportReader::no_string) {
+      sta::print(stream, "  \"source_clock\": \"{}\",\n",
+                 jsonString(reader, end.source_clock));
+      sta::print(stream, "  \"source_clock_edge\": \"{}\",\n",
+                 riseFallName(end.source_clock_rise));
+    }
+    writeJsonStages(reader, stages, stream);
+    if (end.target_clock != PathReportReader::no_string) {
+      sta::print(stream, ",\n  \"target_clock\": \"{}\",\n",
+                 jsonString(reader, end.target_clock));
+      sta::print(stream, "  \"target_clock_edge\": \"{}\"",
+                 riseFallName(end.target_clock_rise));
+    }
+    if (end.has_check) {
+      sta::print(stream, ",\n  \"data_arrival_time\": {:.3e},\n",
+                 end.data_arrival);
+      sta::print(stream, "  \"crpr\": {:.3e},\n", end.crpr);
+      sta::print(stream, "  \"margin\": {:.3e},\n", end.margin);
+      sta::print(stream, "  \"required_time\": {:.3e},\n", end.required);
+      sta::print(stream, "  \"slack\": {:.3e}", end.slack);
+    }
+    sta::print(stream, "\n}}");
+  }
+  sta::print(stream, "\n]\n}}\n");
+  if (stream.fail())
+    throw FileNotWritable(json_filename);
+}
+
+} // namespace sta
@@ -0,0 +1,189 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#include "PathReportWriter.hh"
+
+#include "Clock.hh"
+#include "Delay.hh"
+#include "Error.hh"
+#include "Graph.hh"
+#include "GraphDelayCalc.hh"
+#include "Network.hh"
+#include "Path.hh"
+#include "PathEnd.hh"
+#include "PathExpanded.hh"
+#include "PathGroup.hh"
+#include "ReportPath.hh"
+#include "Transition.hh"
+
+namespace sta {
+
+PathReportWriter::PathReportWriter(const ReportPath *report_path,
+                                   const StaState *sta) :
+  StaState(sta),
+  report_path_(report_path),
+  stream_(nullptr)
+{
+}
+
+PathReportWriter::~PathReportWriter()
+{
+  if (stream_)
+    fclose(stream_);
+}
+
+void
+PathReportWriter::open(std::string_view filename)
+{
+  filename_ = filename;
+  string_indices_.clear();
+  stream_ = fopen(filename_.c_str(), "wb");
+  if (stream_ == nullptr)
+    throw FileNotWritable(filename);
+  writeBytes(PathReportReader::magic, sizeof(PathReportReader::magic));
+  uint32_t version = PathReportReader::version;
+  writeBytes(&version, sizeof(version));
+}
+
+void
+PathReportWriter::close()
+{
+  PathReportTag tag = PathReportTag::end;
+  writeBytes(&tag, sizeof(tag));
+  bool failed = fclose(stream_) != 0;
+  stream_ = nullptr;
+  if (failed)
+    throw FileNotWritable(filename_);
+}
+
+void
+PathReportWriter::writePathEnd(const PathEnd *end)
+{
+  PathExpanded expanded(end->path(), this);
+  const Pin *startpoint = expanded.startPath()->vertex(this)->pin();
+  const Pin *endpoint = expanded.endPath()->vertex(this)->pin();
+  PathReportEnd record{};
+  record.type = stringIndex(end->typeName());
+  record.path_group = stringIndex(end->pathGroup()->name());
+  record.startpoint = stringIndex(sdc_network_->pathName(startpoint));
+  record.endpoint = stringIndex(sdc_network_->pathName(endpoint));
+  record.max = end->minMax(this) == MinMax::max();
+
+  record.source_clock = PathReportReader::no_string;
+  const ClockEdge *src_clk_edge = end->sourceClkEdge(this);
+  if (src_clk_edge) {
+    record.source_clock = stringIndex(src_clk_edge->clock()->name());
+    record.source_clock_rise = src_clk_edge->transition() == RiseFall::rise();
+  }
+  record.target_clock = PathReportReader::no_string;
+  const ClockEdge *tgt_clk_edge = end->targetClkEdge(this);
+  if (tgt_clk_edge) {
+    record.target_clock = stringIndex(tgt_clk_edge->clock()->name());
+    record.target_clock_rise = tgt_clk_edge->transition() == RiseFall::rise();
+  }
+
+  if (end->checkRole(this)) {
+    record.has_check = true;
+    record.data_arrival = delayAsFloat(end->dataArrivalTimeOffset(this));
+    record.crpr = delayAsFloat(end->checkCrpr(this));
+    record.margin = delayAsFloat(end->margin(this));
+    record.required = delayAsFloat(end->requiredTimeOffset(this));
+    record.slack = delayAsFloat(end->slack(this));
+  }
+
+  // Stage names are interned before the record so the string records
+  // precede the path end record that uses them.
+  writeStages(expanded);
+  record.stage_count = stages_.size();
+  PathReportTag tag = PathReportTag::path_end;
+  writeBytes(&tag, sizeof(tag));
+  writeBytes(&record, sizeof(record));
+  writeBytes(stages_.data(), stages_.size() * sizeof(PathReportStage));
+}
+
+void
+PathReportWriter::writeStages(const PathExpanded &expanded)
+{
+  stages_.clear();
+  for (size_t i = expanded.startIndex(); i < expanded.size(); i++) {
+    const Path *path = expanded.path(i);
+    Vertex *vertex = path->vertex(this);
+    const Pin *pin = vertex->pin();
+    const Net *net = network_->net(pin);
+    const Instance *inst = network_->instance(pin);
+    const RiseFall *rf = path->transition(this);
+    PathReportStage &stage = stages_.emplace_back();
+    stage.pin = stringIndex(sdc_network_->pathName(pin));
+    stage.instance = PathReportReader::no_string;
+    stage.cell = PathReportReader::no_string;
+    if (inst) {
+      stage.instance = stringIndex(sdc_network_->pathName(inst));
+      Cell *cell = network_->cell(inst);
+      if (cell)
+        stage.cell = stringIndex(sdc_network_->name(cell));
+    }
+    stage.net = net
+      ? stringIndex(sdc_network_->pathName(net))
+      : PathReportReader::no_string;
+    stage.arrival = delayAsFloat(path->arrival());
+    stage.slew = delayAsFloat(path->slew(this));
+    stage.rise = rf == RiseFall::rise();
+    stage.is_driver = network_->isDriver(pin);
+    if (stage.is_driver) {
+      const Scene *scene = path->scene(this);
+      const MinMax *min_max = path->minMax(this);
+      stage.capacitance = graph_delay_calc_->loadCap(pin, rf, scene, min_max);
+      stage.fanout = report_path_->drvrFanout(vertex, scene, min_max);
+    }
+  }
+}
+
+uint32_t
+PathReportWriter::stringIndex(std::string_view str)
+{
+  auto [itr, inserted] = string_indices_.try_emplace(std::string(str),
+                                                      string_indices_.size());
+  if (inserted) {
+    PathReportTag tag = PathReportTag::string;
+    uint32_t length = str.size();
+    writeBytes(&tag, sizeof(tag));
+    writeBytes(&length, sizeof(length));
+    writeBytes(str.data(), length);
+  }
+  return itr->second;
+}
+
+void
+PathReportWriter::writeBytes(const void *bytes,
+                             size_t size)
+{
+  if (fwrite(bytes, 1, size, stream_) != size) {
+    fclose(stream_);
+    stream_ = nullptr;
+    throw FileNotWritable(filename_);
+  }
+}
+
+} // namespace sta
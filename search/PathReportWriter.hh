@@ -0,0 +1,69 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "PathReportBinary.hh"
+#include "SearchClass.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+class PathExpanded;
+class ReportPath;
+
+// Stream path ends to a binary path report (see PathReportBinary.hh).
+class PathReportWriter : public StaState
+{
+public:
+  PathReportWriter(const ReportPath *report_path,
+                   const StaState *sta);
+  ~PathReportWriter();
+  void open(std::string_view filename);
+  void writePathEnd(const PathEnd *end);
+  void close();
+
+protected:
+  // Index of str in the string table.
+  // New strings are written to the file before the index is returned.
+  uint32_t stringIndex(std::string_view str);
+  void writeStages(const PathExpanded &expanded);
+  void writeBytes(const void *bytes,
+                  size_t size);
+
+  const ReportPath *report_path_;
+  std::string filename_;
+  FILE *stream_;
+  std::unordered_map<std::string, uint32_t> string_indices_;
+  std::vector<PathReportStage> stages_;
+};
+
+} // namespace sta
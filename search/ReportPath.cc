@@ -25,8 +25,10 @@
 #include "ReportPath.hh"
 
 #include <algorithm>            // reverse
+#include <exception>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "ArcDelayCalc.hh"
 #include "CheckMaxSkews.hh"
@@ -34,6 +36,7 @@
 #include "CheckMinPulseWidths.hh"
 #include "ClkInfo.hh"
 #include "ContainerHelpers.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "ExceptionPath.hh"
 #include "Format.hh"
@@ -52,6 +55,7 @@
 #include "PathGroup.hh"
 #include "PortDelay.hh"
 #include "PortDirection.hh"
+#include "Profiler.hh"
 #include "Report.hh"
 #include "Scene.hh"
 #include "Sdc.hh"
@@ -287,6 +291,24 @@ ReportPath::setDigits(int digits)
   field_total_->setWidth(field_width);
 }
 
+std::string
+ReportPath::optionsKey() const
+{
+  std::string key = sta::format("{} {} {} {}{}{}",
+                                static_cast<int>(format_), digits_, no_split_,
+                                report_input_pin_, report_hier_pins_, report_net_);
+  for (const ReportField *field : fields_) {
+    if (field->enabled()) {
+      sta::print(key, " {}:{}", field->name(), field->width());
+      const Unit *unit = field->unit();
+      if (unit)
+        sta::print(key, ":{}", unit->scaleAbbrevSuffix());
+    }
+  }
+  sta::print(key, " {}", units_->timeUnit()->scaleAbbrevSuffix());
+  return key;
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -332,13 +354,20 @@ ReportPath::reportPathEnd(const PathEnd *end,
 void
 ReportPath::reportPathEnds(const PathEndSeq *ends) const
 {
+  ProfileScope profile("report paths");
   reportPathEndHeader();
   if (ends && !ends->empty()) {
-    const PathEnd *prev_end = nullptr;
-    for (size_t i = 0; i < ends->size(); i++) {
-      const PathEnd *end = (*ends)[i];
-      reportPathEnd(end, prev_end, i == ends->size() - 1);
-      prev_end = end;
+    if (thread_count_ > 1
+        && ends->size() > 1
+        && formatPerPathEnd())
+      reportPathEndsParallel(*ends);
+    else {
+      const PathEnd *prev_end = nullptr;
+      for (size_t i = 0; i < ends->size(); i++) {
+        const PathEnd *end = (*ends)[i];
+        reportPathEnd(end, prev_end, i == ends->size() - 1);
+        prev_end = end;
+      }
     }
   }
   else {
@@ -348,6 +377,60 @@ ReportPath::reportPathEnds(const PathEndSeq *ends) const
   reportPathEndFooter();
 }
 
+// Formats that report a multi-line block for each path end.
+bool
+ReportPath::formatPerPathEnd() const
+{
+  return format_ == ReportPathFormat::full
+    || format_ == ReportPathFormat::full_clock
+    || format_ == ReportPathFormat::full_clock_expanded
+    || format_ == ReportPathFormat::shorter
+    || format_ == ReportPathFormat::json;
+}
+
+// Format path ends on the worker threads into per-end buffers and
+// print the buffers in order so the output matches the serial report.
+// Ends are formatted in chunks to bound the memory held in buffers.
+// An exception thrown while formatting an end is thrown again by the
+// calling thread after the ends before it are printed.
+void
+ReportPath::reportPathEndsParallel(const PathEndSeq &ends) const
+{
+  size_t end_count = ends.size();
+  size_t chunk_size = thread_count_ * parallel_ends_per_thread_;
+  size_t buffer_count = std::min(chunk_size, end_count);
+  std::vector<std::string> buffers(buffer_count);
+  std::vector<std::exception_ptr> errors(buffer_count);
+  for (size_t chunk_begin = 0;
+       chunk_begin < end_count;
+       chunk_begin += chunk_size) {
+    size_t chunk_end = std::min(chunk_begin + chunk_size, end_count);
+    dispatch_queue_->parallelFor(chunk_end - chunk_begin, 1,
+                                 [&](size_t, size_t from, size_t to) {
+      for (size_t i = from; i < to; i++) {
+        size_t end_index = chunk_begin + i;
+        std::string &buffer = buffers[i];
+        buffer.clear();
+        errors[i] = nullptr;
+        ReportThreadBuffer thread_buffer(&buffer);
+        try {
+          reportPathEnd(ends[end_index],
+                        end_index > 0 ? ends[end_index - 1] : nullptr,
+                        end_index == end_count - 1);
+        }
+        catch (...) {
+          errors[i] = std::current_exception();
+        }
+      }
+    });
+    for (size_t i = 0; i < chunk_end - chunk_begin; i++) {
+      report_->printThreadBuffer(buffers[i]);
+      if (errors[i])
+        std::rethrow_exception(errors[i]);
+    }
+  }
+}
+
 void
 ReportPath::reportPathEndHeader() const
 {
@@ -110,6 +110,8 @@ public:
   void setNoSplit(bool no_split);
   ReportField *findField(std::string_view name);
   ReportField *findFieldAbrev(std::string_view name);
+  // Options that change the text of reported paths.
+  std::string optionsKey() const;
 
   // Header above reportPathEnd results.
   void reportPathEndHeader() const;
@@ -215,6 +217,10 @@ public:
   ReportField *fieldFanout() const { return field_fanout_; }
   ReportField *fieldCapacitance() const { return field_capacitance_; }
   ReportField *fieldSrcAttr() const { return field_src_attr_; }
+  // Wire fanout of a driver; output ports count their external fanout.
+  float drvrFanout(Vertex *drvr,
+                   const Scene *scene,
+                   const MinMax *min_max) const;
 
 protected:
   void makeFields();
@@ -226,6 +232,8 @@ protected:
                          Unit *unit);
   void reportEndpointHeader(const PathEnd *end,
                             const PathEnd *prev_end) const;
+  bool formatPerPathEnd() const;
+  void reportPathEndsParallel(const PathEndSeq &ends) const;
   void reportShort(const PathEndUnconstrained *end,
                    const PathExpanded &expanded) const;
   void reportShort(const PathEndCheck *end,
@@ -485,9 +493,6 @@ protected:
                          const RiseFall *rf,
                          const MinMax *min_max,
                          const Sdc *sdc) const;
-  float drvrFanout(Vertex *drvr,
-                   const Scene *scene,
-                   const MinMax *min_max) const;
   std::string_view mpwCheckHiLow(const MinPulseWidthCheck &check) const;
   void reportSkewClkPath(std::string_view arrival_msg,
                          const Path *clk_path) const;
@@ -554,6 +559,7 @@ protected:
 
   int field_width_extra_{5};
   size_t start_end_pt_width_{80};
+  static constexpr size_t parallel_ends_per_thread_ = 64;
   static constexpr float field_blank_ = -1;
   static const float field_skip_;
 };
@@ -26,6 +26,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 
 #include "Bfs.hh"
@@ -49,7 +51,6 @@
 #include "LibertyClass.hh"
 #include "MinMax.hh"
 #include "Mode.hh"
-#include "Mutex.hh"
 #include "Network.hh"
 #include "NetworkClass.hh"
 #include "Path.hh"
@@ -57,6 +58,7 @@
 #include "PathGroup.hh"
 #include "PortDelay.hh"
 #include "PortDirection.hh"
+#include "Profiler.hh"
 #include "Report.hh"
 #include "RiseFallMinMaxDelay.hh"
 #include "Scene.hh"
@@ -263,6 +265,7 @@ Search::Search(StaState *sta) :
   tag_set_(new TagSet(tag_capacity_,
                       TagHash(this),
                       TagEqual(this))),
+  exception_state_sets_(new ExceptionStateSetSet),
   tag_group_capacity_(tag_capacity_),
   tag_groups_(new TagGroup *[tag_group_capacity_]),
   tag_group_set_(new TagGroupSet(tag_group_capacity_)),
@@ -294,6 +297,7 @@ Search::~Search()
   deletePaths();
   deleteTags();
   delete tag_set_;
+  delete exception_state_sets_;
   delete clk_info_set_;
   delete[] tags_;
   delete[] tag_groups_;
@@ -315,6 +319,7 @@ void
 Search::clear()
 {
   initVars();
+  timingChanged();
 
   arrivals_seeded_ = false;
   requireds_exist_ = false;
@@ -329,10 +334,13 @@ Search::clear()
   endpointsInvalid();
   deletePathGroups();
   deletePaths();
+  for (const Mode *mode : modes_)
+    mode->genclks()->clear();
   deleteTags();
   pending_arrivals_.clear();
   deleteFilter();
   found_downstream_clk_pins_ = false;
+  check_crpr_->clkTreeIndexInvalid();
 }
 
 void
@@ -379,6 +387,7 @@ Search::deleteTags()
 
   tag_next_ = 0;
   deleteContents(tag_set_);
+  deleteContents(exception_state_sets_);
 
   deleteContents(clk_info_set_);
   deleteTagsPrev();
@@ -427,6 +436,7 @@ void
 Search::deletePaths()
 {
   debugPrint(debug_, "search", 1, "delete paths");
+  check_crpr_->clkTreeIndexInvalid();
   if (arrivals_exist_) {
     VertexIterator vertex_iter(graph_);
     while (vertex_iter.hasNext()) {
@@ -434,17 +444,61 @@ Search::deletePaths()
       deletePaths(vertex);
     }
 
-    deleteContents(enum_paths_);
-
     filtered_arrivals_.clear();
     arrivals_exist_ = false;
   }
+  // Generated clock source paths are saved before arrivals exist.
+  // They are deleted by Genclks.
+  for (size_t i = 0; i < enum_paths_.size(); i++) {
+    if (enum_paths_owned_[i])
+      delete enum_paths_[i];
+  }
+  enum_paths_.clear();
+  enum_paths_owned_.clear();
+  enum_path_free_.clear();
 }
 
 void
-Search::saveEnumPath(Path *path)
+Search::saveEnumPath(EnumPath *path,
+                     bool search_owns)
 {
-  enum_paths_.push_back(path);
+  if (enum_path_free_.empty()) {
+    path->enum_index_ = enum_paths_.size();
+    enum_paths_.push_back(path);
+    enum_paths_owned_.push_back(search_owns);
+  }
+  else {
+    uint32_t index = enum_path_free_.back();
+    enum_path_free_.pop_back();
+    path->enum_index_ = index;
+    enum_paths_[index] = path;
+    enum_paths_owned_[index] = search_owns;
+  }
+}
+
+void
+Search::releaseEnumPath(const EnumPath *path)
+{
+  uint32_t index = path->enum_index_;
+  if (index < enum_paths_.size()
+      && enum_paths_[index] == path) {
+    enum_paths_[index] = nullptr;
+    enum_paths_owned_[index] = false;
+    enum_path_free_.push_back(index);
+  }
+}
+
+uint32_t
+Search::enumPathIndex(const Path *path) const
+{
+  // Paths with is_enum set are EnumPath objects.
+  const EnumPath *enum_path = static_cast<const EnumPath*>(path);
+  uint32_t index = enum_path->enum_index_;
+  if (index < enum_paths_.size()
+      && enum_paths_[index] == enum_path)
+    return index;
+  else
+    return EnumPath::enum_index_null;
 }
 
 // Delete with incremental tns/wns update.
@@ -554,10 +608,32 @@ Search::findFilteredArrivals(ExceptionFrom *from,
 // search used a filter arrival/required times were only found for a
 // subset of the paths.  Delete the paths that have a filter
 // exception state.
+// Set Search::searching_ in a scope so invalidations made by the
+// search are not counted as timing changes.
+class SearchingGuard
+{
+public:
+  SearchingGuard(bool &searching) :
+    searching_(searching),
+    prev_searching_(searching)
+  {
+    searching_ = true;
+  }
+  ~SearchingGuard() { searching_ = prev_searching_; }
+
+private:
+  bool &searching_;
+  bool prev_searching_;
+};
+
 void
 Search::deleteFilteredArrivals()
 {
+  check_crpr_->clkTreeIndexInvalid();
   if (have_filter_) {
+    // Filtered vertices are invalidated to search them again without
+    // the filter, which does not change the timing.
+    SearchingGuard searching(searching_);
     ExceptionThruSeq *thrus = filter_thrus_;
     if ((filter_from_ && (filter_from_->pins() || filter_from_->instances()))
         || thrus) {
@@ -586,7 +662,7 @@ Search::deleteFilteredArrivals()
       deleteFilterTags();
       deleteFilterClkInfos();
     }
-  }
+    }
   // Delete filter_from/thru/to even if there is no filter_.
   deleteFilter();
 }
@@ -621,6 +697,29 @@ Search::deleteFilterTags()
       delete tag;
     }
   }
+  // Filter states refer to the filter exception that is about to be deleted.
+  for (const Mode *mode : modes_) {
+    const FilterPath *filter = mode->sdc()->filter();
+    if (filter) {
+      for (auto itr = exception_state_sets_->begin();
+           itr != exception_state_sets_->end();) {
+        ExceptionStateSet *states = *itr;
+        bool refs_filter = false;
+        for (ExceptionState *state : *states) {
+          if (state->exception() == filter) {
+            refs_filter = true;
+            break;
+          }
+        }
+        if (refs_filter) {
+          itr = exception_state_sets_->erase(itr);
+          delete states;
+        }
+        else
+          itr++;
+      }
+    }
+  }
 }
 
 void
@@ -640,6 +739,8 @@ Search::deleteFilterClkInfos()
 void
 Search::findFilteredArrivals(bool thru_latches)
 {
+  SearchingGuard searching(searching_);
+  check_crpr_->searchBefore();
   // Search always_to_endpoint to search from exisiting arrivals at
   // fanin startpoints to reach -thru/-to endpoints.
   arrival_visitor_->init(true, false, eval_pred_);
@@ -670,6 +771,7 @@ Search::findFilteredArrivals(bool thru_latches)
 
     deleteTagsPrev();
   }
+  check_crpr_->searchAfter();
 }
 
 // Delete stale tag arrarys.
@@ -769,6 +871,7 @@ Search::seedFilterStarts()
 void
 Search::deleteVertexBefore(Vertex *vertex)
 {
+  check_crpr_->clkTreeIndexInvalid();
   if (arrivals_exist_) {
     deletePathsIncr(vertex);
     arrival_iter_->deleteVertexBefore(vertex);
@@ -808,6 +911,7 @@ Search::arrivalsValid()
 void
 Search::arrivalsInvalid()
 {
+  timingChanged();
   if (arrivals_exist_) {
     debugPrint(debug_, "search", 1, "arrivals invalid");
     // Delete paths to make sure no state is left over.
@@ -837,6 +941,7 @@ void
 Search::requiredsInvalid()
 {
   debugPrint(debug_, "search", 1, "requireds invalid");
+  timingChanged();
   requireds_exist_ = false;
   requireds_seeded_ = false;
   invalid_requireds_.clear();
@@ -851,9 +956,10 @@ Search::arrivalInvalid(Vertex *vertex)
   if (arrivals_exist_) {
     debugPrint(debug_, "search", 2, "arrival invalid {}",
                vertex->to_string(this));
+    timingChanged();
     if (!arrival_iter_->inQueue(vertex)) {
       // Lock for StaDelayCalcObserver called by delay calc threads.
-      LockGuard lock(invalid_arrivals_lock_);
+      ProfileLockGuard lock(invalid_arrivals_lock_, "search invalid arrivals");
       invalid_arrivals_.insert(vertex);
     }
     tnsInvalid(vertex);
@@ -929,26 +1035,37 @@ Search::requiredInvalid(Vertex *vertex)
   if (requireds_exist_) {
     debugPrint(debug_, "search", 2, "required invalid {}",
                vertex->to_string(this));
+    timingChanged();
     if (!required_iter_->inQueue(vertex)) {
       // Lock for StaDelayCalcObserver called by delay calc threads.
-      LockGuard lock(invalid_arrivals_lock_);
+      ProfileLockGuard lock(invalid_arrivals_lock_, "search invalid arrivals");
       invalid_requireds_.insert(vertex);
     }
     tnsInvalid(vertex);
   }
 }
 
+void
+Search::timingChanged()
+{
+  if (!searching_)
+    timing_change_count_++;
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
 Search::findClkArrivals()
 {
   debugPrint(debug_, "search", 1, "find clk arrivals");
+  SearchingGuard searching(searching_);
+  check_crpr_->searchBefore();
   arrival_visitor_->init(false, true, eval_pred_);
   arrival_iter_->ensureSize();
   enqueueClkRoots();
   enqueueInvalidClks();
   findArrivals2(levelize_->maxLevel());
+  check_crpr_->searchAfter();
 }
 
 void
@@ -1021,6 +1138,8 @@ Search::findAllArrivals()
 void
 Search::findAllArrivals(bool thru_latches)
 {
+  SearchingGuard searching(searching_);
+  check_crpr_->searchBefore();
   arrival_visitor_->init(false, false, eval_pred_);
   arrival_iter_->ensureSize();
 
@@ -1038,6 +1157,7 @@ Search::findAllArrivals(bool thru_latches)
       arrival_visitor_->visit(vertex, true);
     pending_arrivals_.clear();
   }
+  check_crpr_->searchAfter();
 }
 
 void
@@ -1049,15 +1169,18 @@ Search::findArrivals()
 void
 Search::findArrivals(Level level)
 {
+  SearchingGuard searching(searching_);
   arrival_visitor_->init(false, false, eval_pred_);
   arrival_iter_->ensureSize();
   findArrivals1(level);
+  check_crpr_->searchAfter();
 }
 
 void
 Search::findArrivals1(Level level)
 {
   debugPrint(debug_, "search", 1, "find arrivals to level {}", level);
+  check_crpr_->searchBefore();
   findArrivalsSeed();
   findArrivals2(level);
 }
@@ -1067,6 +1190,7 @@ void
 Search::findArrivals2(Level level)
 {
   Stats stats(debug_, report_);
+  ProfileScope profile("find arrivals");
   int arrival_count = arrival_iter_->visitParallel(level, arrival_visitor_);
   deleteTagsPrev();
   if (arrival_count > 0)
@@ -1329,7 +1453,7 @@ Search::arrivalsChanged(Vertex *vertex,
           || !delayEqual(path1->arrival(), path2->arrival(), this)
           || path1->prevEdge(this) != path2->prevEdge(this)
           || path1->prevArc(this) != path2->prevArc(this)
-          || path1->prevPath() != path2->prevPath())
+          || path1->prevPath(this) != path2->prevPath(this))
         return true;
     }
     return false;
@@ -1438,7 +1562,7 @@ Search::postponeLatchDataOutputs(Vertex *latch_data)
     Edge *edge = edge_iter.next();
     if (edge->role() == TimingRole::latchDtoQ()) {
       Vertex *out_vertex = edge->to(graph_);
-      LockGuard lock(pending_arrivals_lock_);
+      ProfileLockGuard lock(pending_arrivals_lock_, "search pending arrivals");
       pending_arrivals_.insert(out_vertex);
     }
   }
@@ -1447,7 +1571,7 @@ Search::postponeLatchDataOutputs(Vertex *latch_data)
 void
 Search::postponeArrivals(Vertex *vertex)
 {
-  LockGuard lock(pending_arrivals_lock_);
+  ProfileLockGuard lock(pending_arrivals_lock_, "search pending arrivals");
   pending_arrivals_.insert(vertex);
 }
 
@@ -2298,7 +2422,7 @@ Search::pathClkPathArrival1(const Path *path) const
 {
   const Path *p = path;
   while (p) {
-    Path *prev_path = p->prevPath();
+    Path *prev_path = p->prevPath(this);
     Edge *prev_edge = p->prevEdge(this);
 
     if (p->isClock(this))
@@ -2307,7 +2431,7 @@ Search::pathClkPathArrival1(const Path *path) const
       const TimingRole *prev_role = prev_edge->role();
       if (prev_role == TimingRole::regClkToQ()
           || prev_role == TimingRole::latchEnToQ()) {
-        return p->prevPath();
+        return p->prevPath(this);
       }
       else if (prev_role == TimingRole::latchDtoQ()) {
         Path *enable_path = latches_->latchEnablePath(p, prev_edge);
@@ -2657,7 +2781,7 @@ TagGroup *
 Search::findTagGroup(TagGroupBldr *tag_bldr)
 {
   TagGroup probe(tag_bldr, this);
-  LockGuard lock(tag_group_lock_);
+  ProfileLockGuard lock(tag_group_lock_, "search tag group");
   TagGroup *tag_group = findKey(*tag_group_set_, &probe);
   if (tag_group == nullptr) {
     TagGroupIndex tag_group_index;
@@ -2715,7 +2839,7 @@ Search::setVertexArrivals(Vertex *vertex,
       tag_group->incrRefCount();
     }
     if (tag_group->hasFilterTag()) {
-      LockGuard lock(filtered_arrivals_lock_);
+      ProfileLockGuard lock(filtered_arrivals_lock_, "search filtered arrivals");
       filtered_arrivals_.insert(vertex);
     }
   }
@@ -2781,7 +2905,7 @@ Search::reportArrivals(Vertex *vertex,
       bool report_prev = true;
       std::string prev_str;
       if (report_prev) {
-        Path *prev_path = path->prevPath();
+        Path *prev_path = path->prevPath(this);
         if (prev_path) {
           const Edge *prev_edge = path->prevEdge(this);
           TimingArc *arc = path->prevArc(this);
@@ -2898,26 +3022,25 @@ Search::findTag(Scene *scene,
                 bool own_states,
                 TagSet *tag_cache)
 {
+  if (own_states)
+    states = internStates(states);
   Tag probe(scene, 0, rf, min_max, clk_info, is_clk, input_delay, is_segment_start,
-            states, false);
+            states);
   if (tag_cache) {
     Tag *tag = findKey(*tag_cache, &probe);
     if (tag)
       return tag;
   }
 
-  LockGuard lock(tag_lock_);
+  ProfileLockGuard lock(tag_lock_, "search tag");
   Tag *tag = findKey(*tag_set_, &probe);
   if (tag == nullptr) {
     // Make rise/fall versions of the tag to avoid tag_set lookups when the
     // only change is the rise/fall edge.
     for (const RiseFall *rf1 : RiseFall::range()) {
-      ExceptionStateSet *new_states =
-          !own_states && states ? new ExceptionStateSet(*states) : states;
       TagIndex tag_index = tag_next_++;
       Tag *tag1 = new Tag(scene, tag_index, rf1, min_max, clk_info, is_clk,
-                          input_delay, is_segment_start, new_states, true);
-      own_states = false;
+                          input_delay, is_segment_start, states);
       // Make sure tag can be indexed in tags_ before it is visible to
       // other threads via tag_set_.
       tags_[tagsTableRfIndex(tag_index, rf1)] = tag1;
@@ -2944,11 +3067,33 @@ Search::findTag(Scene *scene,
       tag_set_->reserve(tag_capacity);
     }
   }
-  if (own_states)
-    delete states;
   return tag;
 }
 
+ExceptionStateSet *
+Search::internStates(ExceptionStateSet *states)
+{
+  if (states == nullptr)
+    return nullptr;
+  if (states->empty()) {
+    delete states;
+    return nullptr;
+  }
+  {
+    std::shared_lock lock(exception_state_sets_lock_);
+    auto itr = exception_state_sets_->find(states);
+    if (itr != exception_state_sets_->end()) {
+      delete states;
+      return *itr;
+    }
+  }
+  std::unique_lock lock(exception_state_sets_lock_);
+  auto [itr, inserted] = exception_state_sets_->insert(states);
+  if (!inserted)
+    delete states;
+  return *itr;
+}
+
 void
 Search::reportTags() const
 {
@@ -2996,7 +3141,7 @@ Search::findClkInfo(Scene *scene,
   const ClkInfo probe(scene, clk_edge, clk_src, is_propagated, gen_clk_src,
                       gen_clk_src_path, pulse_clk_sense, insertion, latency,
                       uncertainties, min_max, crpr_clk_path, this);
-  LockGuard lock(clk_info_lock_);
+  ProfileLockGuard lock(clk_info_lock_, "search clk info");
   const ClkInfo *clk_info = findKey(*clk_info_set_, &probe);
   if (clk_info == nullptr) {
     clk_info = new ClkInfo(scene, clk_edge, clk_src, is_propagated, gen_clk_src,
@@ -3159,6 +3304,7 @@ void
 Search::findRequireds(Level level)
 {
   Stats stats(debug_, report_);
+  ProfileScope profile("find requireds");
   debugPrint(debug_, "search", 1, "find requireds to level {}", level);
   RequiredVisitor req_visitor(this);
   required_iter_->ensureSize();
@@ -3745,7 +3891,7 @@ Search::tnsInvalid(Vertex *vertex)
 {
   if ((tns_exists_ || worst_slacks_) && isEndpoint(vertex)) {
     debugPrint(debug_, "tns", 2, "tns invalid {}", vertex->to_string(this));
-    LockGuard lock(tns_lock_);
+    ProfileLockGuard lock(tns_lock_, "search tns");
     invalid_tns_.insert(vertex);
   }
 }
@@ -31,14 +31,17 @@
 #include "Units.hh"
 #include "PathGroup.hh"
 #include "Search.hh"
+#include "search/Crpr.hh"
 #include "search/Levelize.hh"
 #include "search/ReportPath.hh"
 #include "search/Tag.hh"
 #include "PathExpanded.hh"
+#include "PathReportBinary.hh"
 #include "Bfs.hh"
 #include "Scene.hh"
 #include "Sta.hh"
 #include "StaConfig.hh"
+#include "TimingArrays.hh"
 
 using namespace sta;
 
@@ -164,6 +167,42 @@ endpoint_count()
   return Sta::sta()->endpointPins().size();
 }
 
+// Slacks, arrivals, requireds and slews of the pins concatenated
+// into one list.
+FloatSeq
+timing_arrays_cmd(PinSeq *pins,
+                  bool all_endpoints,
+                  SceneSeq scenes)
+{
+  Sta *sta = Sta::sta();
+  TimingArrays arrays;
+  if (all_endpoints)
+    sta->endpointTimingArrays(scenes, arrays);
+  else
+    sta->timingArrays(*pins, scenes, arrays);
+  FloatSeq values;
+  values.reserve(arrays.slacks().size() * 4);
+  for (const FloatSeq *array : {&arrays.slacks(), &arrays.arrivals(),
+                                &arrays.requireds(), &arrays.slews()})
+    values.insert(values.end(), array->begin(), array->end());
+  return values;
+}
+
+void
+write_timing_arrays_cmd(PinSeq *pins,
+                        bool all_endpoints,
+                        SceneSeq scenes,
+                        std::string filename)
+{
+  Sta *sta = Sta::sta();
+  TimingArrays arrays;
+  if (all_endpoints)
+    sta->endpointTimingArrays(scenes, arrays);
+  else
+    sta->timingArrays(*pins, scenes, arrays);
+  arrays.write(filename, sta->sdcNetwork());
+}
+
 void
 find_requireds()
 {
@@ -313,6 +352,12 @@ report_clk_infos()
   Sta::sta()->search()->reportClkInfos();
 }
 
+void
+set_crpr_clk_tree_index(bool use)
+{
+  Sta::sta()->search()->checkCrpr()->setUseClkTreeIndex(use);
+}
+
 int
 clk_info_count()
 {
@@ -401,6 +446,40 @@ find_path_ends(ExceptionFrom *from,
   return ends;
 }
 
+void
+report_checks_cmd(ExceptionFrom *from,
+                  ExceptionThruSeq *thrus,
+                  ExceptionTo *to,
+                  bool unconstrained,
+                  SceneSeq scenes,
+                  const MinMaxAll *delay_min_max,
+                  int group_path_count,
+                  int endpoint_path_count,
+                  bool unique_pins,
+                  bool unique_edges,
+                  float slack_min,
+                  float slack_max,
+                  bool sort_by_slack,
+                  StringSeq path_groups,
+                  bool setup,
+                  bool hold,
+                  bool recovery,
+                  bool removal,
+                  bool clk_gating_setup,
+                  bool clk_gating_hold)
+{
+  Sta *sta = Sta::sta();
+  sta->reportChecks(from, thrus, to, unconstrained,
+                    scenes, delay_min_max,
+                    group_path_count, endpoint_path_count,
+                    unique_pins, unique_edges,
+                    slack_min, slack_max,
+                    sort_by_slack, path_groups,
+                    setup, hold,
+                    recovery, removal,
+                    clk_gating_setup, clk_gating_hold);
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -496,6 +575,20 @@ report_path_ends(PathEndSeq *ends)
   Sta::sta()->reportPathEnds(ends);
 }
 
+void
+write_path_report_cmd(std::string filename,
+                      PathEndSeq *ends)
+{
+  Sta::sta()->writePathReport(filename, ends);
+}
+
+void
+write_path_report_json_cmd(std::string filename,
+                           std::string json_filename)
+{
+  writePathReportJson(filename, json_filename, Sta::sta()->report());
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -1126,6 +1219,30 @@ set_use_default_arrival_clock(bool enable)
   Sta::sta()->setUseDefaultArrivalClock(enable);
 }
 
+bool
+graph_frozen_adjacency()
+{
+  return Sta::sta()->graphFrozenAdjacency();
+}
+
+void
+set_graph_frozen_adjacency(bool enable)
+{
+  Sta::sta()->setGraphFrozenAdjacency(enable);
+}
+
+int
+report_checks_cache_size()
+{
+  return Sta::sta()->reportChecksCacheSize();
+}
+
+void
+set_report_checks_cache_size(int size)
+{
+  Sta::sta()->setReportChecksCacheSize(size);
+}
+
 %} // inline
 
 ////////////////////////////////////////////////////////////////
@@ -1255,7 +1372,7 @@ pins()
   Path *path1 = self;
   while (path1) {
     pins.push_back(path1->vertex(sta)->pin());
-    path1 = path1->prevPath();
+    path1 = path1->prevPath(sta);
   }
   return pins;
 }
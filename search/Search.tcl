@@ -148,7 +148,8 @@ proc find_timing_paths { args } {
   return $path_ends
 }
 
-proc find_timing_paths_cmd { cmd args_var } {
+# Report the paths instead of returning them when report is 1.
+proc find_timing_paths_cmd { cmd args_var { report 0 } } {
   global sta_report_unconstrained_paths
   upvar 1 $args_var args
 
@@ -263,6 +264,16 @@ proc find_timing_paths_cmd { cmd args_var } {
       sta_error 515 "positional arguments not supported."
     }
   }
+  if { $report } {
+    report_checks_cmd $from $thrus $to $unconstrained \
+      $scenes $min_max \
+      $group_path_count $endpoint_path_count \
+      $unique_pins $unique_edges \
+      $slack_min $slack_max \
+      $sort_by_slack $groups \
+      1 1 1 1 1 1
+    return {}
+  }
   set path_ends [find_path_ends $from $thrus $to $unconstrained \
                    $scenes $min_max \
                    $group_path_count $endpoint_path_count \
@@ -417,8 +428,89 @@ See `set_false_path` for a description of allowed from_list, through_list and to
 proc_redirect report_checks {
   global sta_report_unconstrained_paths
   parse_report_path_options "report_checks" args "full" 0
-  set path_ends [find_timing_paths_cmd "report_checks" args]
-  report_path_ends $path_ends
+  if { [report_checks_cache_size] == 0 } {
+    set path_ends [find_timing_paths_cmd "report_checks" args]
+    report_path_ends $path_ends
+  } else {
+    # Reuse saved reports for repeated queries.
+    find_timing_paths_cmd "report_checks" args 1
+  }
+}
+
+################################################################
+
+define_cmd_args "write_path_report" \
+  {[-from from_list|-rise_from from_list|-fall_from from_list]\
+     [-through through_list|-rise_through through_list|-fall_through through_list]\
+     [-to to_list|-rise_to to_list|-fall_to to_list]\
+     [-unconstrained]\
+     [-path_delay min|min_rise|min_fall|max|max_rise|max_fall|min_max]\
+     [-scenes scenes]\
+     [-group_path_count path_count] \
+     [-endpoint_path_count path_count]\
+     [-unique_paths_to_endpoint]\
+     [-unique_edges_to_endpoint]\
+     [-slack_max slack_max]\
+     [-slack_min slack_min]\
+     [-sort_by_slack]\
+     [-path_group group_name]\
+     filename} \
+  -help {The `write_path_report` command writes the paths found with the `report_checks` options to a compact binary file. Each path end has the path group, start and end points, clocks, arrival, required, crpr, margin and slack. Each stage of the data path has the pin, instance, cell and net names, transition, arrival and slew, and the load capacitance and fanout of drivers. Names are written once in a string table. The file format is described in `PathReportBinary.hh`, which also has a C++ reader. Use `write_path_report_json` to convert the file to json.} \
+  -arg_help {
+    filename {The binary path report filename to write.}
+  }
+
+proc write_path_report { args } {
+  if { [llength $args] == 0 } {
+    sta_error 597 "write_path_report missing filename."
+  }
+  set filename [file nativename [lindex $args end]]
+  set args [lrange $args 0 end-1]
+  set path_ends [find_timing_paths_cmd "write_path_report" args]
+  write_path_report_cmd $filename $path_ends
+}
+
+define_cmd_args "write_path_report_json" {filename json_filename} \
+  -help {Convert a binary path report written by `write_path_report` to json with the same keys as `report_checks -format json`.} \
+  -arg_help {
+    filename {The binary path report filename to read.}
+    json_filename {The json filename to write.}
+  }
+
+proc write_path_report_json { args } {
+  check_argc_eq2 "write_path_report_json" $args
+  lassign $args filename json_filename
+  write_path_report_json_cmd [file nativename $filename] \
+    [file nativename $json_filename]
+}
+
+################################################################
+
+define_cmd_args "report_checks_batch" {queries [> filename] [>> filename]} \
+  -help {The `report_checks_batch` command reports a list of `report_checks` queries in one call. Each query is a list of `report_checks` arguments. The queries are reported in order. Reports for repeated queries are reused until the timing changes.} \
+  -arg_help {
+    queries {List of `report_checks` argument lists.}
+  }
+
+proc_redirect report_checks_batch {
+  global sta_report_checks_cache_size
+
+  check_argc_eq1 "report_checks_batch" $args
+  set queries [lindex $args 0]
+  # Use the cache for the batch if it is disabled.
+  set cache_size $sta_report_checks_cache_size
+  if { $cache_size == 0 } {
+    set sta_report_checks_cache_size [llength $queries]
+  }
+  set code [catch {
+    foreach query $queries {
+      report_checks {*}$query
+    }
+  } result]
+  set sta_report_checks_cache_size $cache_size
+  if { $code == 1 } {
+    error $result
+  }
 }
 
 ################################################################
@@ -721,6 +813,70 @@ proc_redirect report_worst_slack {
 
 ################################################################
 
+define_cmd_args "get_timing_arrays" {[-scenes scenes] [-all_endpoints] [pins]} \
+  -help {Return the worst slack, arrival, required and slew of each pin as a list of four lists {slacks arrivals requireds slews}. Each list has four values per pin in the order rise min, rise max, fall min, fall max. Values are in seconds. Pins are visited in parallel when the thread count is greater than one.} \
+  -arg_help {
+    -scenes {Use paths and slews from these scenes. The default is all scenes.}
+    -all_endpoints {Return the values for the timing endpoints in the order returned by `sta::endpoints`.}
+    pins {A list of pins or ports.}
+  }
+
+proc get_timing_arrays { args } {
+  parse_key_args "get_timing_arrays" args keys {-scenes} flags {-all_endpoints}
+  lassign [parse_timing_arrays_args "get_timing_arrays" keys flags $args] \
+    pins all_endpoints scenes
+  set values [timing_arrays_cmd $pins $all_endpoints $scenes]
+  set size [expr [llength $values] / 4]
+  set arrays {}
+  for {set i 0} {$i < 4} {incr i} {
+    lappend arrays [lrange $values [expr $i * $size] [expr ($i + 1) * $size - 1]]
+  }
+  return $arrays
+}
+
+define_cmd_args "write_timing_arrays" \
+  {[-scenes scenes] [-all_endpoints] [-pins pins] filename} \
+  -help {Write the worst slack, arrival, required and slew of each pin to a binary file. The file has the magic "OSTATARR", a uint32 version, a uint32 value count per pin (4), a uint64 pin count, the pin names as a uint32 length followed by the characters, and then float arrays of slacks, arrivals, requireds and slews in the order used by `get_timing_arrays`. Integers and floats are in native byte order. Values are in seconds.} \
+  -arg_help {
+    -scenes {Use paths and slews from these scenes. The default is all scenes.}
+    -all_endpoints {Write the values for the timing endpoints.}
+    -pins {A list of pins or ports.}
+    filename {The binary filename to write.}
+  }
+
+proc write_timing_arrays { args } {
+  parse_key_args "write_timing_arrays" args keys {-scenes -pins} \
+    flags {-all_endpoints}
+  check_argc_eq1 "write_timing_arrays" $args
+  set filename [file nativename [lindex $args 0]]
+  set pin_args {}
+  if { [info exists keys(-pins)] } {
+    set pin_args [list $keys(-pins)]
+  }
+  lassign [parse_timing_arrays_args "write_timing_arrays" keys flags $pin_args] \
+    pins all_endpoints scenes
+  write_timing_arrays_cmd $pins $all_endpoints $scenes $filename
+}
+
+proc parse_timing_arrays_args { cmd keys_var flags_var pin_args } {
+  upvar 1 $keys_var keys
+  upvar 1 $flags_var flags
+  set scenes [parse_scenes_or_all keys]
+  set all_endpoints [info exists flags(-all_endpoints)]
+  set pins {}
+  if { $all_endpoints } {
+    if { $pin_args != {} } {
+      sta_error 596 "$cmd -all_endpoints and pins are mutually exclusive."
+    }
+  } else {
+    check_argc_eq1 $cmd $pin_args
+    set pins [get_port_pins_error "pins" [lindex $pin_args 0]]
+  }
+  return [list $pins $all_endpoints $scenes]
+}
+
+################################################################
+
 # Note that -all and -tags are intentionally "hidden".
 define_cmd_args "report_path" \
   {[-min|-max]\
@@ -1029,6 +1185,7 @@ proc worst_clock_skew { args } {
 define_cmd_args "write_timing_model" {[-scene scene] \
                                         [-library_name lib_name]\
                                         [-cell_name cell_name]\
+                                        [-threads count]\
                                         filename} \
   -help {The `write_timing_model` command constructs a liberty timing model for the current design and writes it to filename. cell_name defaults to the cell name of the top level block in the design.
 
@@ -1058,12 +1215,13 @@ The extracted timing model setup/hold checks are scalar (no input slew dependenc
     -library_name {The name to use for the liberty library. Defaults to cell_name.}
     -cell_name {The name to use for the liberty cell. Defaults to the top level module name.}
     -scene {The scene to use for extracting the model.}
+    -threads {The number of threads used to visit the path ends reached from each input port. The input ports are searched one at a time. Defaults to the current thread count.}
     filename {Filename for the liberty timing model.}
   }
 
 proc write_timing_model { args } {
   parse_key_args "write_timing_model" args \
-    keys {-library_name -cell_name -scene} flags {}
+    keys {-library_name -cell_name -scene -threads} flags {}
   check_argc_eq1 "write_timing_model" $args
 
   set filename [file nativename [lindex $args 0]]
@@ -1078,8 +1236,20 @@ proc write_timing_model { args } {
     set lib_name $cell_name
   }
   set scene [parse_scene keys]
-  write_timing_model_cmd $lib_name $cell_name $filename $scene
-    
+  if { [info exists keys(-threads)] } {
+    set threads $keys(-threads)
+    check_positive_integer "-threads" $threads
+    set prev_threads [thread_count]
+    set_thread_count $threads
+    set error [catch {write_timing_model_cmd $lib_name $cell_name \
+                        $filename $scene} result]
+    set_thread_count $prev_threads
+    if { $error } {
+      error $result
+    }
+  } else {
+    write_timing_model_cmd $lib_name $cell_name $filename $scene
+  }
 }
 
 ################################################################
@@ -24,10 +24,13 @@
 
 #include "Sim.hh"
 
+#include <algorithm>
+
 // https://davidkebo.com/cudd
 #include "cudd.h"
 
 #include "ContainerHelpers.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "Mutex.hh"
 #include "Debug.hh"
@@ -42,6 +45,7 @@
 #include "Network.hh"
 #include "Sdc.hh"
 #include "Graph.hh"
+#include "Levelize.hh"
 #include "Mode.hh"
 
 namespace sta {
@@ -117,6 +121,65 @@ Sim::functionSense(const FuncExpr *expr,
 LogicValue
 Sim::evalExpr(const FuncExpr *expr,
               const Instance *inst)
+{
+  const SimTruthTable *table = truthTable(expr);
+  if (table) {
+    SimPortValues port_values;
+    findPortValues(inst, port_values);
+    return table->eval(port_values);
+  }
+  else
+    return evalExprBdd(expr, inst);
+}
+
+LogicValue
+Sim::evalExpr(const FuncExpr *expr,
+              const Instance *inst,
+              const SimPortValues &port_values)
+{
+  const SimTruthTable *table = truthTable(expr);
+  if (table)
+    return table->eval(port_values);
+  else
+    return evalExprBdd(expr, inst);
+}
+
+void
+Sim::findPortValues(const Instance *inst,
+                    // Return value.
+                    SimPortValues &port_values) const
+{
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    LogicValue value = simValue(pin);
+    if (value == LogicValue::zero || value == LogicValue::one) {
+      const LibertyPort *port = network_->libertyPort(pin);
+      if (port)
+        port_values.emplace_back(port, value);
+    }
+  }
+  delete pin_iter;
+}
+
+// Return nullptr if the function has too many ports for a truth table.
+const SimTruthTable *
+Sim::truthTable(const FuncExpr *expr)
+{
+  {
+    std::shared_lock lock(truth_tables_lock_);
+    auto itr = truth_tables_.find(expr);
+    if (itr != truth_tables_.end())
+      return itr->second.valid() ? &itr->second : nullptr;
+  }
+  std::unique_lock lock(truth_tables_lock_);
+  auto [itr, inserted] = truth_tables_.try_emplace(expr, expr);
+  return itr->second.valid() ? &itr->second : nullptr;
+}
+
+LogicValue
+Sim::evalExprBdd(const FuncExpr *expr,
+                 const Instance *inst)
 {
   LockGuard lock(bdd_lock_);
   DdNode *bdd = funcBddSim(expr, inst);
@@ -168,6 +231,83 @@ Sim::funcBddSim(const FuncExpr *expr,
   return bdd;
 }
 
+////////////////////////////////////////////////////////////////
+
+// Minterms with port index i = 1.
+static constexpr uint64_t port_minterms[SimTruthTable::max_ports] = {
+  0xaaaaaaaaaaaaaaaaULL,
+  0xccccccccccccccccULL,
+  0xf0f0f0f0f0f0f0f0ULL,
+  0xff00ff00ff00ff00ULL,
+  0xffff0000ffff0000ULL,
+  0xffffffff00000000ULL
+};
+
+SimTruthTable::SimTruthTable(const FuncExpr *expr)
+{
+  table_ = exprTable(expr);
+}
+
+uint64_t
+SimTruthTable::exprTable(const FuncExpr *expr)
+{
+  switch (expr->op()) {
+    case FuncExpr::Op::port: {
+      const LibertyPort *port = expr->port();
+      for (size_t i = 0; i < port_count_; i++) {
+        if (ports_[i] == port)
+          return port_minterms[i];
+      }
+      if (port_count_ == max_ports || port->hasMembers()) {
+        valid_ = false;
+        return 0;
+      }
+      ports_[port_count_] = port;
+      return port_minterms[port_count_++];
+    }
+    case FuncExpr::Op::not_:
+      return ~exprTable(expr->left());
+    case FuncExpr::Op::or_:
+      return exprTable(expr->left()) | exprTable(expr->right());
+    case FuncExpr::Op::and_:
+      return exprTable(expr->left()) & exprTable(expr->right());
+    case FuncExpr::Op::xor_:
+      return exprTable(expr->left()) ^ exprTable(expr->right());
+    case FuncExpr::Op::one:
+      return ~0ULL;
+    case FuncExpr::Op::zero:
+      return 0;
+  }
+  return 0;
+}
+
+LogicValue
+SimTruthTable::eval(const SimPortValues &port_values) const
+{
+  // Minterms that match the constant port values.
+  uint64_t care = ~0ULL;
+  for (size_t i = 0; i < port_count_; i++) {
+    for (const auto &[port, value] : port_values) {
+      if (port == ports_[i]) {
+        if (value == LogicValue::one)
+          care &= port_minterms[i];
+        else
+          care &= ~port_minterms[i];
+        break;
+      }
+    }
+  }
+  uint64_t care_table = table_ & care;
+  if (care_table == care)
+    return LogicValue::one;
+  else if (care_table == 0)
+    return LogicValue::zero;
+  else
+    return LogicValue::unknown;
+}
+
+////////////////////////////////////////////////////////////////
+
 static LogicValue
 logicNot(LogicValue value)
 {
@@ -189,6 +329,7 @@ Sim::clear()
   invalid_drvr_pins_.clear();
   invalid_load_pins_.clear();
   clearSimValues();
+  truth_tables_.clear();
 }
 
 void
@@ -461,6 +602,7 @@ Sim::pinSetFuncAfter(const Pin *pin)
 {
   if (incremental_)
     valid_ = false;
+  truth_tables_.clear();
   // Incrementally update const_func_pins_.
   const_func_pins_.erase(pin);
   recordConstPinFunc(pin);
@@ -483,10 +625,110 @@ Sim::seedConstants()
 void
 Sim::propagateConstants(bool thru_sequentials)
 {
+  if (thread_count_ > 1)
+    propagateConstantsParallel(thru_sequentials);
+  else {
+    SimPinValues pin_values;
+    while (!eval_queue_.empty()) {
+      const Instance *inst = eval_queue_.front();
+      eval_queue_.pop();
+      evalInstance(inst, thru_sequentials, pin_values);
+      setPinValues(pin_values);
+      pin_values.clear();
+    }
+  }
+}
+
+// The queued instances are evaluated in level order.
+// Instances with the same level cannot drive each other so they are
+// evaluated in parallel and their output values are set after the
+// whole level is evaluated. Output values set instances in the fanout
+// to be evaluated in the next pass.
+void
+Sim::propagateConstantsParallel(bool thru_sequentials)
+{
+  bool use_levels = levelize_->levelized();
+  std::vector<std::pair<Level, const Instance*>> level_insts;
+  InstanceSet queued_insts(network_);
+  std::vector<SimPinValues> thread_pin_values(thread_count_);
   while (!eval_queue_.empty()) {
-    const Instance *inst = eval_queue_.front();
-    eval_queue_.pop();
-    evalInstance(inst, thru_sequentials);
+    level_insts.clear();
+    queued_insts.clear();
+    while (!eval_queue_.empty()) {
+      const Instance *inst = eval_queue_.front();
+      eval_queue_.pop();
+      if (!queued_insts.contains(inst)) {
+        queued_insts.insert(inst);
+        level_insts.emplace_back(use_levels ? instanceLevel(inst) : 0, inst);
+      }
+    }
+    std::stable_sort(level_insts.begin(), level_insts.end(),
+                     [] (const std::pair<Level, const Instance*> &inst1,
+                         const std::pair<Level, const Instance*> &inst2) {
+                       return inst1.first < inst2.first;
+                     });
+
+    size_t level_begin = 0;
+    while (level_begin < level_insts.size()) {
+      Level level = level_insts[level_begin].first;
+      size_t level_end = level_begin;
+      while (level_end < level_insts.size()
+             && level_insts[level_end].first == level)
+        level_end++;
+
+      size_t inst_count = level_end - level_begin;
+      if (inst_count < thread_count_) {
+        for (size_t i = level_begin; i < level_end; i++)
+          evalInstance(level_insts[i].second, thru_sequentials,
+                       thread_pin_values[0]);
+      }
+      else {
+        size_t chunk_size = inst_count / thread_count_;
+        size_t from = level_begin;
+        for (size_t k = 0; k < thread_count_; k++) {
+          // Last thread gets the left overs.
+          size_t to = (k == thread_count_ - 1) ? level_end : from + chunk_size;
+          SimPinValues *pin_values = &thread_pin_values[k];
+          dispatch_queue_->deferTask([=, this, &level_insts](size_t) {
+            for (size_t i = from; i < to; i++)
+              evalInstance(level_insts[i].second, thru_sequentials, *pin_values);
+          });
+          from = to;
+        }
+        dispatch_queue_->finishTasks();
+      }
+      // Set values in instance order.
+      for (SimPinValues &pin_values : thread_pin_values) {
+        setPinValues(pin_values);
+        pin_values.clear();
+      }
+      level_begin = level_end;
+    }
+  }
+}
+
+// Max level of the instance input pins.
+Level
+Sim::instanceLevel(const Instance *inst) const
+{
+  Level level = 0;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    Vertex *vertex = graph_->pinLoadVertex(pin);
+    if (vertex && network_->isLoad(pin))
+      level = std::max(level, vertex->level());
+  }
+  delete pin_iter;
+  return level;
+}
+
+void
+Sim::setPinValues(const SimPinValues &pin_values)
+{
+  for (const auto &[pin, value] : pin_values) {
+    if (value != simValue(pin))
+      setPinValue(pin, value);
   }
 }
 
@@ -623,11 +865,17 @@ Sim::setPinValue(const Pin *pin,
   }
 }
 
+// Find the output pin values of an instance without setting them so
+// instances can be evaluated in parallel.
 void
 Sim::evalInstance(const Instance *inst,
-                  bool thru_sequentials)
+                  bool thru_sequentials,
+                  // Return value.
+                  SimPinValues &pin_values)
 {
   debugPrint(debug_, "sim", 2, "eval {}", network_->pathName(inst));
+  SimPortValues port_values;
+  findPortValues(inst, port_values);
   InstancePinIterator *pin_iter = network_->pinIterator(inst);
   while (pin_iter->hasNext()) {
     Pin *pin = pin_iter->next();
@@ -641,8 +889,8 @@ Sim::evalInstance(const Instance *inst,
         if (expr) {
           FuncExpr *tri_en_expr = port->tristateEnable();
           if (tri_en_expr) {
-            if (evalExpr(tri_en_expr, inst) == LogicValue::one) {
-              value = evalExpr(expr, inst);
+            if (evalExpr(tri_en_expr, inst, port_values) == LogicValue::one) {
+              value = evalExpr(expr, inst, port_values);
               debugPrint(debug_, "sim", 2, " {} tri_en=1 {} = {}", port->name(),
                          expr->to_string(), logicValueString(value));
             }
@@ -653,14 +901,14 @@ Sim::evalInstance(const Instance *inst,
                 ? cell->outputPortSequential(expr_port)
                 : nullptr;
             if (sequential) {
-              value = evalExpr(sequential->data(), inst);
+              value = evalExpr(sequential->data(), inst, port_values);
               if (expr_port == sequential->outputInv())
                 value = logicNot(value);
               debugPrint(debug_, "sim", 2, " {} seq {} = {}", port->name(),
                          expr->to_string(), logicValueString(value));
             }
             else {
-              value = evalExpr(expr, inst);
+              value = evalExpr(expr, inst, port_values);
               debugPrint(debug_, "sim", 2, " {} {} = {}", port->name(),
                          expr->to_string(), logicValueString(value));
             }
@@ -672,7 +920,7 @@ Sim::evalInstance(const Instance *inst,
                      logicValueString(value));
         }
         if (value != simValue(pin))
-          setPinValue(pin, value);
+          pin_values.emplace_back(pin, value);
       }
     }
   }
@@ -24,10 +24,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <mutex>
 #include <queue>
+#include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "Bdd.hh"
 #include "GraphClass.hh"
@@ -40,11 +44,39 @@
 namespace sta {
 
 class SimObserver;
+class SimTruthTable;
 
 using SimValueMap = std::unordered_map<const Pin*, LogicValue>;
 using EdgeDisabledCondSet = std::unordered_set<const Edge*>;
 using EdgeTimingSenseMap = std::unordered_map<const Edge*, TimingSense>;
 using EvalQueue = std::queue<const Instance*>;
+// Constant (zero/one) values of instance pins by liberty port.
+using SimPortValues = std::vector<std::pair<const LibertyPort*, LogicValue>>;
+using SimPinValues = std::vector<std::pair<const Pin*, LogicValue>>;
+using SimTruthTableMap = std::unordered_map<const FuncExpr*, SimTruthTable>;
+
+// FuncExpr compiled to a truth table over (up to 6) port indices.
+// The value is constant if it is the same for every minterm that
+// matches the constant port values, which is the same result as
+// composing the function BDD with the constants.
+class SimTruthTable
+{
+public:
+  static constexpr size_t max_ports = 6;
+
+  SimTruthTable(const FuncExpr *expr);
+  // False if the function has too many ports for a table.
+  bool valid() const { return valid_; }
+  LogicValue eval(const SimPortValues &port_values) const;
+
+private:
+  uint64_t exprTable(const FuncExpr *expr);
+
+  bool valid_{true};
+  size_t port_count_{0};
+  const LibertyPort *ports_[max_ports];
+  uint64_t table_{0};
+};
 
 // Propagate constants from constraints and netlist tie high/low
 // connections thru gates.
@@ -75,6 +107,9 @@ public:
 
   LogicValue evalExpr(const FuncExpr *expr,
                       const Instance *inst);
+  LogicValue evalExpr(const FuncExpr *expr,
+                      const Instance *inst,
+                      const SimPortValues &port_values);
   // Timing sense for the function between from_pin and to_pin
   // after simplifying the function based constants on the pins.
   TimingSense functionSense(const Instance *inst,
@@ -125,6 +160,9 @@ protected:
   void seedConstants();
   void seedInvalidConstants();
   void propagateConstants(bool thru_sequentials);
+  void propagateConstantsParallel(bool thru_sequentials);
+  Level instanceLevel(const Instance *inst) const;
+  void setPinValues(const SimPinValues &pin_values);
   void setConstraintConstPins(const LogicValueMap &pin_value_map);
   void setConstFuncPins();
   LogicValue pinConstFuncValue(const Pin *pin);
@@ -139,7 +177,15 @@ protected:
                          bool disabled);
   void enqueue(const Instance *inst);
   void evalInstance(const Instance *inst,
-                    bool thru_sequentials);
+                    bool thru_sequentials,
+                    // Return value.
+                    SimPinValues &pin_values);
+  void findPortValues(const Instance *inst,
+                      // Return value.
+                      SimPortValues &port_values) const;
+  const SimTruthTable *truthTable(const FuncExpr *expr);
+  LogicValue evalExprBdd(const FuncExpr *expr,
+                         const Instance *inst);
   LogicValue clockGateOutValue(const Instance *inst);
   TimingSense functionSense(const FuncExpr *expr,
                             const Pin *input_pin,
@@ -188,6 +234,8 @@ protected:
   InstanceSet instances_to_annotate_;
   Bdd bdd_;
   mutable std::mutex bdd_lock_;
+  SimTruthTableMap truth_tables_;
+  std::shared_mutex truth_tables_lock_;
 };
 
 // Abstract base class for Sim value change observer.
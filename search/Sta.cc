@@ -37,6 +37,7 @@
 #include "CheckMinPulseWidths.hh"
 #include "CheckSlews.hh"
 #include "CheckTiming.hh"
+#include "Checkpoint.hh"
 #include "CircuitSim.hh"
 #include "ClkInfo.hh"
 #include "ClkLatency.hh"
@@ -52,6 +53,7 @@
 #include "DispatchQueue.hh"
 #include "EquivCells.hh"
 #include "ExceptionPath.hh"
+#include "FilteredReportCache.hh"
 #include "FindRegister.hh"
 #include "Format.hh"
 #include "FuncExpr.hh"
@@ -70,12 +72,14 @@
 #include "MakeConcreteNetwork.hh"
 #include "MakeTimingModel.hh"
 #include "MinMax.hh"
+#include "NetlistEditBatch.hh"
 #include "Mode.hh"
 #include "Network.hh"
 #include "NetworkClass.hh"
 #include "Parasitics.hh"
 #include "PathExpanded.hh"
 #include "PathGroup.hh"
+#include "PathReportWriter.hh"
 #include "PatternMatch.hh"
 #include "PocvMode.hh"
 #include "PortDirection.hh"
@@ -95,9 +99,11 @@
 #include "StringUtil.hh"
 #include "TagGroup.hh"
 #include "TimingArc.hh"
+#include "TimingArrays.hh"
 #include "TimingRole.hh"
 #include "Units.hh"
 #include "Variables.hh"
+#include "WhatIf.hh"
 #include "VerilogReader.hh"
 #include "VisitPathEnds.hh"
 #include "Wireload.hh"
@@ -283,6 +289,8 @@ Sta::makeComponents()
   makeLatches();
   makeSdcNetwork();
   makeReportPath();
+  report_checks_cache_ = new FilteredReportCache(this);
+  netlist_edit_batch_ = new NetlistEditBatch(this);
   makePower();
   makeClkSkews();
   makeCheckTiming();
@@ -343,6 +351,8 @@ Sta::updateComponentsState()
   latches_->copyState(this);
   graph_delay_calc_->copyState(this);
   report_path_->copyState(this);
+  report_checks_cache_->copyState(this);
+  netlist_edit_batch_->copyState(this);
   check_timing_->copyState(this);
   clk_skews_->copyState(this);
 
@@ -497,6 +507,9 @@ Sta::~Sta()
   delete clk_skews_;
   delete check_timing_;
   delete report_path_;
+  delete report_checks_cache_;
+  delete netlist_edit_batch_;
+  delete what_if_;
   // Sdc references search filter, so delete search first.
   delete search_;
   delete latches_;
@@ -549,6 +562,10 @@ Sta::clearNonSdc()
     mode->sdc()->inputDelayRefPinEdgesInvalid();
   }
   search_->clear();
+  netlist_edit_batch_->clear();
+  // The edits in a what-if session refer to the deleted network.
+  delete what_if_;
+  what_if_ = nullptr;
 
   delete graph_;
   graph_ = nullptr;
@@ -694,10 +711,12 @@ LibertyLibrary *
 Sta::readLiberty(std::string_view filename,
                  Scene *scene,
                  const MinMaxAll *min_max,
-                 bool infer_latches)
+                 bool infer_latches,
+                 bool lazy)
 {
   Stats stats(debug_, report_);
-  LibertyLibrary *library = readLibertyFile(filename, scene, min_max, infer_latches);
+  LibertyLibrary *library = readLibertyFile(filename, scene, min_max,
+                                            infer_latches, lazy);
   if (library
       // The default library is the first library read.
       // This corresponds to a link_path of '*'.
@@ -714,9 +733,11 @@ LibertyLibrary *
 Sta::readLibertyFile(std::string_view filename,
                      Scene *scene,
                      const MinMaxAll *min_max,
-                     bool infer_latches)
+                     bool infer_latches,
+                     bool lazy)
 {
-  LibertyLibrary *liberty = sta::readLibertyFile(filename, infer_latches, network_);
+  LibertyLibrary *liberty = sta::readLibertyFile(filename, infer_latches, lazy,
+                                                 network_);
   if (liberty) {
     // Don't map liberty cells if they are redefined by reading another
     // library with the same cell names.
@@ -804,6 +825,7 @@ Sta::setAnalysisType(AnalysisType analysis_type,
                      Sdc *sdc)
 {
   if (analysis_type != sdc->analysisType()) {
+    checkWhatIfDelayCount();
     sdc->setAnalysisType(analysis_type);
     delaysInvalid();
     search_->deletePathGroups();
@@ -2337,6 +2359,7 @@ void
 Sta::setPocvMode(PocvMode mode)
 {
   if (mode != variables_->pocvMode()) {
+    checkWhatIfDelayCount();
     variables_->setPocvMode(mode);
 
     delete delay_ops_;
@@ -2367,7 +2390,7 @@ Sta::checkLibrarayPocv()
   LibertyLibraryIterator *lib_iter = network_->libertyLibraryIterator();
   while (lib_iter->hasNext()) {
     LibertyLibrary *lib = lib_iter->next();
-    LibertyCellIterator cell_iter(lib);
+    LibertyCellIterator cell_iter(lib, true);
     while (cell_iter.hasNext()) {
       LibertyCell *cell = cell_iter.next();
       for (const TimingArcSet *arc_set : cell->timingArcSets()) {
@@ -2532,6 +2555,21 @@ Sta::setUseDefaultArrivalClock(bool enable)
   }
 }
 
+bool
+Sta::graphFrozenAdjacency() const
+{
+  return variables_->graphFrozenAdjacency();
+}
+
+// The frozen edge arrays are made by the next search.
+void
+Sta::setGraphFrozenAdjacency(bool enable)
+{
+  variables_->setGraphFrozenAdjacency(enable);
+  if (!enable && graph_)
+    graph_->deleteFrozenAdjacency();
+}
+
 bool
 Sta::propagateAllClocks() const
 {
@@ -2589,6 +2627,7 @@ Sta::makeScenes(const StringSeq &scene_names)
 {
   if (scene_names.size() > scene_count_max)
     report_->error(1553, "maximum scene count exceeded");
+  checkWhatIfDelayCount();
   Parasitics *parasitics = findParasitics("default");
   Mode *mode = modes_[0];
   mode->sdc()->makeSceneBefore();
@@ -2614,6 +2653,7 @@ Sta::makeScene(const std::string &name,
 {
   Mode *mode = findMode(mode_name);
   if (mode) {
+    checkWhatIfDelayCount();
     Parasitics *parasitics_default = findParasitics("default");
     Parasitics *parasitics_min = parasitics_default;
     Parasitics *parasitics_max = parasitics_default;
@@ -2906,6 +2946,95 @@ Sta::reportPathEnds(PathEndSeq *ends)
   report_path_->reportPathEnds(ends);
 }
 
+void
+Sta::writePathReport(std::string_view filename,
+                     const PathEndSeq *ends)
+{
+  PathReportWriter writer(report_path_, this);
+  writer.open(filename);
+  for (const PathEnd *end : *ends)
+    writer.writePathEnd(end);
+  writer.close();
+}
+
+void
+Sta::reportChecks(ExceptionFrom *from,
+                  ExceptionThruSeq *thrus,
+                  ExceptionTo *to,
+                  bool unconstrained,
+                  const SceneSeq &scenes,
+                  const MinMaxAll *min_max,
+                  int group_path_count,
+                  int endpoint_path_count,
+                  bool unique_pins,
+                  bool unique_edges,
+                  float slack_min,
+                  float slack_max,
+                  bool sort_by_slack,
+                  StringSeq &group_names,
+                  bool setup,
+                  bool hold,
+                  bool recovery,
+                  bool removal,
+                  bool clk_gating_setup,
+                  bool clk_gating_hold)
+{
+  std::string key;
+  if (report_checks_cache_->capacity() > 0) {
+    // Update delays before the lookup so the cache sees timing changes.
+    searchPreamble();
+    std::string options = sta::format("{} {} {} {} {}{} {} {} {} {}{}{}{}{}{} {}",
+                                      unconstrained, min_max->index(),
+                                      group_path_count, endpoint_path_count,
+                                      unique_pins, unique_edges,
+                                      slack_min, slack_max, sort_by_slack,
+                                      setup, hold, recovery, removal,
+                                      clk_gating_setup, clk_gating_hold,
+                                      report_path_->optionsKey());
+    for (const Scene *scene : scenes)
+      sta::print(options, " {}", scene->index());
+    for (const std::string &group_name : group_names)
+      sta::print(options, " {}", group_name);
+    key = report_checks_cache_->queryKey(from, thrus, to, options);
+    const std::string *text = report_checks_cache_->find(key);
+    if (text) {
+      report_->printString(text->c_str(), text->size());
+      delete from;
+      if (thrus) {
+        deleteContents(*thrus);
+        delete thrus;
+      }
+      delete to;
+      return;
+    }
+  }
+  PathEndSeq ends = findPathEnds(from, thrus, to, unconstrained, scenes, min_max,
+                                 group_path_count, endpoint_path_count,
+                                 unique_pins, unique_edges, slack_min, slack_max,
+                                 sort_by_slack, group_names, setup, hold,
+                                 recovery, removal,
+                                 clk_gating_setup, clk_gating_hold);
+  if (report_checks_cache_->capacity() > 0) {
+    report_->captureBegin();
+    reportPathEnds(&ends);
+    report_checks_cache_->insert(key, report_->captureEnd());
+  }
+  else
+    reportPathEnds(&ends);
+}
+
+size_t
+Sta::reportChecksCacheSize() const
+{
+  return report_checks_cache_->capacity();
+}
+
+void
+Sta::setReportChecksCacheSize(size_t size)
+{
+  report_checks_cache_->setCapacity(size);
+}
+
 void
 Sta::reportPath(const Path *path)
 {
@@ -3278,6 +3407,119 @@ Sta::slack(Vertex *vertex,
   return slack;
 }
 
+// Worst values of the paths on the pin vertices for each rise/fall
+// and min/max.
+static void
+pinTimingArrays(const Pin *pin,
+                size_t pin_index,
+                const SceneSeq &scenes,
+                const SceneSet &scenes_set,
+                const StaState *sta,
+                // Return value.
+                TimingArrays &arrays)
+{
+  const Search *search = sta->search();
+  Graph *graph = sta->graph();
+  Vertex *vertex, *bidirect_drvr_vertex;
+  graph->pinVertices(pin, vertex, bidirect_drvr_vertex);
+  Slack slacks[TimingArrays::value_count];
+  Arrival arrivals[TimingArrays::value_count];
+  Required requireds[TimingArrays::value_count];
+  Slew slews[TimingArrays::value_count];
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (const MinMax *min_max : MinMax::range()) {
+      size_t index = TimingArrays::index(0, rf, min_max);
+      slacks[index] = MinMax::min()->initValue();
+      arrivals[index] = min_max->initValue();
+      requireds[index] = min_max->opposite()->initValue();
+      slews[index] = min_max->initValue();
+    }
+  }
+  for (Vertex *pin_vertex : {vertex, bidirect_drvr_vertex}) {
+    if (pin_vertex == nullptr)
+      continue;
+    VertexPathIterator path_iter(pin_vertex, sta);
+    while (path_iter.hasNext()) {
+      const Path *path = path_iter.next();
+      if (scenes_set.contains(path->scene(sta))) {
+        const MinMax *min_max = path->minMax(sta);
+        size_t index = TimingArrays::index(0, path->transition(sta), min_max);
+        Slack path_slack = path->slack(sta);
+        if (delayLess(path_slack, slacks[index], sta))
+          slacks[index] = path_slack;
+        const Required &path_required = path->required();
+        if (delayGreater(path_required, requireds[index],
+                         min_max->opposite(), sta))
+          requireds[index] = path_required;
+        const Arrival &path_arrival = path->arrival();
+        if (!path->clkInfo(search)->isGenClkSrcPath()
+            && delayGreater(path_arrival, arrivals[index], min_max, sta))
+          arrivals[index] = path_arrival;
+      }
+    }
+    for (const Scene *scene : scenes) {
+      for (const MinMax *min_max : MinMax::range()) {
+        DcalcAPIndex ap_index = scene->dcalcAnalysisPtIndex(min_max);
+        for (const RiseFall *rf : RiseFall::range()) {
+          size_t index = TimingArrays::index(0, rf, min_max);
+          Slew slew = graph->slew(pin_vertex, rf, ap_index);
+          if (delayGreater(slew, slews[index], min_max, sta))
+            slews[index] = slew;
+        }
+      }
+    }
+  }
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (const MinMax *min_max : MinMax::range()) {
+      size_t index = TimingArrays::index(0, rf, min_max);
+      size_t pin_value_index = TimingArrays::index(pin_index, rf, min_max);
+      arrays.slacks()[pin_value_index] =
+        delayAsFloat(slacks[index], MinMax::min(), sta);
+      arrays.arrivals()[pin_value_index] =
+        delayAsFloat(arrivals[index], min_max, sta);
+      arrays.requireds()[pin_value_index] =
+        delayAsFloat(requireds[index], min_max->opposite(), sta);
+      arrays.slews()[pin_value_index] =
+        delayAsFloat(slews[index], min_max, sta);
+    }
+  }
+}
+
+void
+Sta::timingArrays(const PinSeq &pins,
+                  const SceneSeq &scenes,
+                  // Return value.
+                  TimingArrays &arrays)
+{
+  findRequireds();
+  arrays.init(pins);
+  const SceneSet scenes_set = Scene::sceneSet(scenes);
+  auto find_pin_arrays = [&] (size_t from,
+                              size_t to) {
+    for (size_t i = from; i < to; i++)
+      pinTimingArrays(pins[i], i, scenes, scenes_set, this, arrays);
+  };
+  if (thread_count_ == 1)
+    find_pin_arrays(0, pins.size());
+  else
+    dispatch_queue_->parallelFor(pins.size(), 0,
+                                 [&] (size_t,
+                                      size_t from,
+                                      size_t to) {
+      find_pin_arrays(from, to);
+    });
+}
+
+void
+Sta::endpointTimingArrays(const SceneSeq &scenes,
+                          // Return value.
+                          TimingArrays &arrays)
+{
+  PinSet endpoint_pins = endpointPins();
+  PinSeq pins(endpoint_pins.begin(), endpoint_pins.end());
+  timingArrays(pins, scenes, arrays);
+}
+
 void
 Sta::slacks(Vertex *vertex,
             Slack (&slacks)[RiseFall::index_count][MinMax::index_count])
@@ -3676,6 +3918,25 @@ Sta::findDelays(Level level)
   graph_delay_calc_->findDelays(level);
 }
 
+void
+Sta::writeCheckpoint(std::string_view filename)
+{
+  ensureGraph();
+  findDelays();
+  Checkpoint checkpoint(this);
+  checkpoint.write(filename);
+}
+
+void
+Sta::readCheckpoint(std::string_view filename)
+{
+  ensureGraph();
+  delayCalcPreamble();
+  Checkpoint checkpoint(this);
+  checkpoint.read(filename);
+  search_->arrivalsInvalid();
+}
+
 void
 Sta::delayCalcPreamble()
 {
@@ -3795,6 +4056,9 @@ void
 Sta::ensureLevelized()
 {
   ensureGraph();
+  // Timing in a netlist edit batch sees the edits so far.
+  if (netlist_edit_depth_ > 0)
+    netlist_edit_batch_->finish();
   levelize_->ensureLevelized();
 }
 
@@ -4415,12 +4679,16 @@ Sta::makeInstance(const char *name,
   Instance *inst = network->makeInstance(cell, name, parent);
   network->makePins(inst);
   makeInstanceAfter(inst);
+  if (what_if_)
+    what_if_->makeInstance(inst);
   return inst;
 }
 
 void
 Sta::deleteInstance(Instance *inst)
 {
+  if (what_if_)
+    report_->error(1596, "delete_instance is not supported in a what-if session.");
   NetworkEdit *network = networkCmdEdit();
   deleteInstanceBefore(inst);
   network->deleteInstance(inst);
@@ -4448,6 +4716,8 @@ Sta::replaceCell(Instance *inst,
                  LibertyCell *to_lib_cell)
 {
   NetworkEdit *network = networkCmdEdit();
+  if (what_if_)
+    what_if_->replaceCell(inst);
   LibertyCell *from_lib_cell = network->libertyCell(inst);
   if (sta::equivCellsArcs(from_lib_cell, to_lib_cell)) {
     // Replace celll optimized for less disruption to graph
@@ -4476,6 +4746,8 @@ Sta::makeNet(const char *name,
   else {
     Net *net = network->makeNet(escaped, parent);
     // Sta notification unnecessary.
+    if (what_if_)
+      what_if_->makeNet(net);
     return net;
   }
 }
@@ -4483,6 +4755,8 @@ Sta::makeNet(const char *name,
 void
 Sta::deleteNet(Net *net)
 {
+  if (what_if_)
+    report_->error(1597, "delete_net is not supported in a what-if session.");
   NetworkEdit *network = networkCmdEdit();
   deleteNetBefore(net);
   network->deleteNet(net);
@@ -4496,6 +4770,8 @@ Sta::connectPin(Instance *inst,
   NetworkEdit *network = networkCmdEdit();
   Pin *pin = network->connect(inst, port, net);
   connectPinAfter(pin);
+  if (what_if_)
+    what_if_->connectPin(pin);
 }
 
 void
@@ -4506,12 +4782,16 @@ Sta::connectPin(Instance *inst,
   NetworkEdit *network = networkCmdEdit();
   Pin *pin = network->connect(inst, port, net);
   connectPinAfter(pin);
+  if (what_if_)
+    what_if_->connectPin(pin);
 }
 
 void
 Sta::disconnectPin(Pin *pin)
 {
   NetworkEdit *network = networkCmdEdit();
+  if (what_if_)
+    what_if_->disconnectPin(pin);
   disconnectPinBefore(pin);
   network->disconnectPin(pin);
 }
@@ -4531,6 +4811,115 @@ Sta::makePortPin(const char *port_name,
   makePortPinAfter(pin);
 }
 
+void
+Sta::beginWhatIf()
+{
+  if (what_if_)
+    report_->error(1598, "what-if session already started.");
+  ensureGraph();
+  // Delays saved in the session must be up to date.
+  findDelays();
+  graph_->saveDelays();
+  what_if_ = new WhatIf(this);
+}
+
+void
+Sta::commitWhatIf()
+{
+  if (what_if_ == nullptr)
+    report_->error(1599, "no what-if session.");
+  graph_->deleteSavedDelays();
+  delete what_if_;
+  what_if_ = nullptr;
+}
+
+void
+Sta::discardWhatIf()
+{
+  if (what_if_ == nullptr)
+    report_->error(1600, "no what-if session.");
+  // Restore the delays before the edits are undone so the vertices and
+  // edges made in the session still exist. Delay calculation at the
+  // undone edits then finds the restored delays and does not propagate.
+  VertexSeq restored;
+  graph_->restoreDelays(restored);
+  for (Vertex *vertex : restored) {
+    search_->arrivalInvalid(vertex);
+    search_->requiredInvalid(vertex);
+  }
+  WhatIf *what_if = what_if_;
+  what_if_ = nullptr;
+  what_if->undo();
+  delete what_if;
+}
+
+void
+Sta::checkWhatIfDelayCount()
+{
+  if (what_if_)
+    report_->error(1613, "analysis points cannot change in a what-if session.");
+}
+
+void
+Sta::beginNetlistEdit()
+{
+  netlist_edit_depth_++;
+}
+
+void
+Sta::endNetlistEdit()
+{
+  if (netlist_edit_depth_ == 0)
+    report_->error(1607, "end_netlist_edit without begin_netlist_edit.");
+  if (--netlist_edit_depth_ == 0)
+    netlist_edit_batch_->finish();
+}
+
+void
+Sta::editDelayInvalid(Vertex *vertex)
+{
+  if (netlist_edit_depth_ > 0)
+    netlist_edit_batch_->delayInvalid(vertex);
+  else
+    graph_delay_calc_->delayInvalid(vertex);
+}
+
+void
+Sta::editArrivalInvalid(Vertex *vertex)
+{
+  if (netlist_edit_depth_ > 0)
+    netlist_edit_batch_->arrivalInvalid(vertex);
+  else
+    search_->arrivalInvalid(vertex);
+}
+
+void
+Sta::editRequiredInvalid(Vertex *vertex)
+{
+  if (netlist_edit_depth_ > 0)
+    netlist_edit_batch_->requiredInvalid(vertex);
+  else
+    search_->requiredInvalid(vertex);
+}
+
+void
+Sta::editEndpointInvalid(Vertex *vertex)
+{
+  if (netlist_edit_depth_ > 0)
+    netlist_edit_batch_->endpointInvalid(vertex);
+  else
+    search_->endpointInvalid(vertex);
+}
+
+void
+Sta::editRelevelizeFrom(Vertex *vertex)
+{
+  if (netlist_edit_depth_ > 0)
+    netlist_edit_batch_->relevelizeFrom(vertex);
+  else
+    levelize_->relevelizeFrom(vertex);
+}
+
 ////////////////////////////////////////////////////////////////
 //
 // Network edit before/after methods.
@@ -4554,9 +4943,9 @@ Sta::makeInstanceAfter(const Instance *inst)
           Vertex *vertex, *bidir_drvr_vertex;
           graph_->makePinVertices(pin, vertex, bidir_drvr_vertex);
           if (vertex)
-            search_->endpointInvalid(vertex);
+            editEndpointInvalid(vertex);
           if (bidir_drvr_vertex)
-            search_->endpointInvalid(bidir_drvr_vertex);
+            editEndpointInvalid(bidir_drvr_vertex);
         }
       }
       graph_->makeInstanceEdges(inst);
@@ -4607,7 +4996,7 @@ Sta::replaceEquivCellBefore(const Instance *inst,
           // Force delay calculation on output pins.
           Vertex *vertex = graph_->pinDrvrVertex(pin);
           if (vertex)
-            graph_delay_calc_->delayInvalid(vertex);
+            editDelayInvalid(vertex);
         }
       }
     }
@@ -4745,11 +5134,11 @@ Sta::connectPinAfter(const Pin *pin)
       Vertex *vertex, *bidir_drvr_vertex;
       graph_->pinVertices(pin, vertex, bidir_drvr_vertex);
       if (vertex) {
-        search_->arrivalInvalid(vertex);
-        search_->requiredInvalid(vertex);
+        editArrivalInvalid(vertex);
+        editRequiredInvalid(vertex);
         if (bidir_drvr_vertex) {
-          search_->arrivalInvalid(bidir_drvr_vertex);
-          search_->requiredInvalid(bidir_drvr_vertex);
+          editArrivalInvalid(bidir_drvr_vertex);
+          editRequiredInvalid(bidir_drvr_vertex);
         }
 
         // Make interconnect edges from/to pin.
@@ -4782,8 +5171,8 @@ Sta::connectDrvrPinAfter(Vertex *vertex)
   while (edge_iter.hasNext()) {
     Edge *edge = edge_iter.next();
     Vertex *to_vertex = edge->to(graph_);
-    search_->arrivalInvalid(to_vertex);
-    search_->endpointInvalid(to_vertex);
+    editArrivalInvalid(to_vertex);
+    editEndpointInvalid(to_vertex);
     for (Mode *mode : modes_)
       mode->sdc()->clkHpinDisablesChanged(to_vertex->pin());
   }
@@ -4792,10 +5181,10 @@ Sta::connectDrvrPinAfter(Vertex *vertex)
     mode->sdc()->clkHpinDisablesChanged(pin);
     mode->clkNetwork()->connectPinAfter(pin);
   }
-  graph_delay_calc_->delayInvalid(vertex);
-  search_->requiredInvalid(vertex);
-  search_->endpointInvalid(vertex);
-  levelize_->relevelizeFrom(vertex);
+  editDelayInvalid(vertex);
+  editRequiredInvalid(vertex);
+  editEndpointInvalid(vertex);
+  editRelevelizeFrom(vertex);
 }
 
 void
@@ -4807,9 +5196,9 @@ Sta::connectLoadPinAfter(Vertex *vertex)
     Edge *edge = edge_iter.next();
     if (!edge->role()->isTimingCheck()) {
       Vertex *from_vertex = edge->from(graph_);
-      graph_delay_calc_->delayInvalid(from_vertex);
-      search_->requiredInvalid(from_vertex);
-      levelize_->relevelizeFrom(from_vertex);
+      editDelayInvalid(from_vertex);
+      editRequiredInvalid(from_vertex);
+      editRelevelizeFrom(from_vertex);
       for (Mode *mode : modes_)
         mode->sdc()->clkHpinDisablesChanged(from_vertex->pin());
     }
@@ -4819,9 +5208,9 @@ Sta::connectLoadPinAfter(Vertex *vertex)
     mode->sdc()->clkHpinDisablesChanged(pin);
     mode->clkNetwork()->connectPinAfter(pin);
   }
-  graph_delay_calc_->delayInvalid(vertex);
-  search_->arrivalInvalid(vertex);
-  search_->endpointInvalid(vertex);
+  editDelayInvalid(vertex);
+  editArrivalInvalid(vertex);
+  editEndpointInvalid(vertex);
 }
 
 void
@@ -4892,8 +5281,8 @@ Sta::deleteEdge(Edge *edge)
   Vertex *to = edge->to(graph_);
   if (!edge->role()->isTimingCheck()) {
     search_->deleteEdgeBefore(edge);
-    graph_delay_calc_->delayInvalid(to);
-    levelize_->relevelizeFrom(to);
+    editDelayInvalid(to);
+    editRelevelizeFrom(to);
     levelize_->deleteEdgeBefore(edge);
     for (Mode *mode : modes_)
       mode->sdc()->clkHpinDisablesChanged(edge->from(graph_)->pin());
@@ -4986,6 +5375,7 @@ Sta::deletePinBefore(const Pin *pin)
         levelize_->deleteVertexBefore(vertex);
         graph_delay_calc_->deleteVertexBefore(vertex);
         search_->deleteVertexBefore(vertex);
+        netlist_edit_batch_->deleteVertexBefore(vertex);
 
         VertexInEdgeIterator in_edge_iter(vertex, graph_);
         while (in_edge_iter.hasNext()) {
@@ -4993,7 +5383,7 @@ Sta::deletePinBefore(const Pin *pin)
           if (edge->role()->isWire()) {
             Vertex *from = edge->from(graph_);
             // Only notify to_vertex (from_vertex will be deleted).
-            search_->requiredInvalid(from);
+            editRequiredInvalid(from);
           }
           levelize_->deleteEdgeBefore(edge);
         }
@@ -5007,6 +5397,7 @@ Sta::deletePinBefore(const Pin *pin)
         levelize_->deleteVertexBefore(vertex);
         graph_delay_calc_->deleteVertexBefore(vertex);
         search_->deleteVertexBefore(vertex);
+        netlist_edit_batch_->deleteVertexBefore(vertex);
 
         VertexOutEdgeIterator edge_iter(vertex, graph_);
         while (edge_iter.hasNext()) {
@@ -5014,9 +5405,9 @@ Sta::deletePinBefore(const Pin *pin)
           if (edge->role()->isWire()) {
             // Only notify to vertex (from will be deleted).
             Vertex *to = edge->to(graph_);
-            search_->arrivalInvalid(to);
-            graph_delay_calc_->delayInvalid(to);
-            levelize_->relevelizeFrom(to);
+            editArrivalInvalid(to);
+            editDelayInvalid(to);
+            editRelevelizeFrom(to);
           }
           levelize_->deleteEdgeBefore(edge);
         }
@@ -5031,6 +5422,7 @@ Sta::deletePinBefore(const Pin *pin)
         levelize_->deleteVertexBefore(vertex);
         graph_delay_calc_->deleteVertexBefore(vertex);
         search_->deleteVertexBefore(vertex);
+        netlist_edit_batch_->deleteVertexBefore(vertex);
         graph_->deleteVertex(vertex);
       }
     }
@@ -5081,9 +5473,9 @@ Sta::delaysInvalidFrom(const Pin *pin)
 void
 Sta::delaysInvalidFrom(Vertex *vertex)
 {
-  search_->arrivalInvalid(vertex);
-  search_->requiredInvalid(vertex);
-  graph_delay_calc_->delayInvalid(vertex);
+  editArrivalInvalid(vertex);
+  editRequiredInvalid(vertex);
+  editDelayInvalid(vertex);
 }
 
 void
@@ -5142,7 +5534,7 @@ Sta::delaysInvalidFromFanin(Vertex *vertex)
     if (edge->isWire()) {
       Vertex *from_vertex = edge->from(graph_);
       delaysInvalidFrom(from_vertex);
-      search_->requiredInvalid(from_vertex);
+      editRequiredInvalid(from_vertex);
     }
   }
 }
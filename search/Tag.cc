@@ -45,8 +45,7 @@ Tag::Tag(Scene *scene,
          bool is_clk,
          InputDelay *input_delay,
          bool is_segment_start,
-         ExceptionStateSet *states,
-         bool own_states) :
+         ExceptionStateSet *states) :
   scene_(scene),
   clk_info_(clk_info),
   input_delay_(input_delay),
@@ -54,7 +53,6 @@ Tag::Tag(Scene *scene,
   index_(index),
   is_clk_(is_clk),
   is_segment_start_(is_segment_start),
-  own_states_(own_states),
   rf_index_(rf->index()),
   min_max_index_(min_max->index())
 {
@@ -71,12 +69,6 @@ Tag::Tag(Scene *scene,
   }
 }
 
-Tag::~Tag()
-{
-  if (own_states_ && states_)
-    delete states_;
-}
-
 std::string
 Tag::to_string(const StaState *sta) const
 {
@@ -365,7 +357,10 @@ Tag::equal(const Tag *tag1,
            const Tag *tag2,
            const StaState *sta)
 {
-  return cmp(tag1, tag2, sta) == 0;
+  // Interned states are equal only if they are the same set.
+  return tag1 == tag2
+    || (tag1->states() == tag2->states()
+        && cmp(tag1, tag2, sta) == 0);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -400,7 +395,9 @@ Tag::match(const Tag *tag1,
            const Tag *tag2,
            const StaState *sta)
 {
-  return Tag::matchCmp(tag1, tag2, true, sta) == 0;
+  return tag1 == tag2
+    || (tag1->states() == tag2->states()
+        && Tag::matchCmp(tag1, tag2, true, sta) == 0);
 }
 
 bool
@@ -409,7 +406,9 @@ Tag::match(const Tag *tag1,
            bool match_crpr_clk_pin,
            const StaState *sta)
 {
-  return Tag::matchCmp(tag1, tag2, match_crpr_clk_pin, sta) == 0;
+  return tag1 == tag2
+    || (tag1->states() == tag2->states()
+        && Tag::matchCmp(tag1, tag2, match_crpr_clk_pin, sta) == 0);
 }
 
 int
@@ -544,6 +543,8 @@ Tag::stateCmp(const Tag *tag1,
 {
   ExceptionStateSet *states1 = tag1->states();
   ExceptionStateSet *states2 = tag2->states();
+  if (states1 == states2)
+    return 0;
   bool states_null1 = (states1 == nullptr || states1->empty());
   bool states_null2 = (states2 == nullptr || states2->empty());
   if (states_null1
@@ -582,7 +583,7 @@ bool
 Tag::stateEqual(const Tag *tag1,
                 const Tag *tag2)
 {
-  return stateCmp(tag1, tag2) == 0;
+  return tag1->states() == tag2->states();
 }
 
 // Match loop exception states only for crpr min/max paths.
@@ -652,6 +653,24 @@ TagEqual::operator()(const Tag *tag1,
   return Tag::equal(tag1, tag2, sta_);
 }
 
+size_t
+ExceptionStateSetHash::operator()(const ExceptionStateSet *states) const
+{
+  size_t hash = hash_init_value;
+  for (ExceptionState *state : *states)
+    hashIncr(hash, state->hash());
+  return hash;
+}
+
+bool
+ExceptionStateSetEqual::operator()(const ExceptionStateSet *states1,
+                                   const ExceptionStateSet *states2) const
+{
+  return *states1 == *states2;
+}
+
+////////////////////////////////////////////////////////////////
+
 TagMatchHash::TagMatchHash(bool match_crpr_clk_pin,
                            const StaState *sta) :
   match_crpr_clk_pin_(match_crpr_clk_pin),
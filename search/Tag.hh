@@ -62,9 +62,7 @@ public:
       bool is_clk,
       InputDelay *input_delay,
       bool is_segment_start,
-      ExceptionStateSet *states,
-      bool own_states);
-  ~Tag();
+      ExceptionStateSet *states);
   std::string to_string(const StaState *sta) const;
   std::string to_string(bool report_index,
                         bool report_rf_min_max,
@@ -80,6 +78,8 @@ public:
   const MinMax *minMax() const;
   int minMaxIndex() const { return min_max_index_; }
   TagIndex index() const { return index_; }
+  // Exception states are interned by Search::internStates so tags
+  // with equal states share the same set.
   ExceptionStateSet *states() const { return states_; }
   void setStates(ExceptionStateSet *states);
   bool isGenClkSrcPath() const;
@@ -141,8 +141,6 @@ private:
   bool is_filter_:1 {false};
   bool is_loop_:1 {false};
   bool is_segment_start_:1 {false};
-  // Indicates that states_ is owned by the tag.
-  bool own_states_:1 {false};
   unsigned int rf_index_:RiseFall::index_bit_count;
   unsigned int min_max_index_:MinMax::index_bit_count;
 };
@@ -186,4 +184,17 @@ private:
   const StaState *sta_;
 };
 
+class ExceptionStateSetHash
+{
+public:
+  size_t operator()(const ExceptionStateSet *states) const;
+};
+
+class ExceptionStateSetEqual
+{
+public:
+  bool operator()(const ExceptionStateSet *states1,
+                  const ExceptionStateSet *states2) const;
+};
+
 } // namespace sta
@@ -276,7 +276,7 @@ TagGroupBldr::insertPath(Tag *tag,
 void
 TagGroupBldr::insertPath(const Path &path)
 {
-  insertPath(path.tag(sta_), path.arrival(), path.prevPath(), path.prevEdge(sta_),
+  insertPath(path.tag(sta_), path.arrival(), path.prevPath(sta_), path.prevEdge(sta_),
              path.prevArc(sta_));
 }
 
@@ -0,0 +1,95 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "TimingArrays.hh"
+
+#include <cstdio>
+#include <string>
+
+#include "Error.hh"
+#include "Network.hh"
+
+namespace sta {
+
+void
+TimingArrays::init(const PinSeq &pins)
+{
+  pins_ = pins;
+  size_t size = pins.size() * value_count;
+  slacks_.assign(size, MinMax::min()->initValue());
+  arrivals_.resize(size);
+  requireds_.resize(size);
+  slews_.resize(size);
+  for (size_t i = 0; i < pins.size(); i++) {
+    for (const RiseFall *rf : RiseFall::range()) {
+      for (const MinMax *min_max : MinMax::range()) {
+        size_t index = TimingArrays::index(i, rf, min_max);
+        arrivals_[index] = min_max->initValue();
+        requireds_[index] = min_max->opposite()->initValue();
+        slews_[index] = min_max->initValue();
+      }
+    }
+  }
+}
+
+static void
+writeBytes(FILE *stream,
+           const void *bytes,
+           size_t size,
+           std::string_view filename)
+{
+  if (fwrite(bytes, 1, size, stream) != size) {
+    fclose(stream);
+    throw FileNotWritable(filename);
+  }
+}
+
+void
+TimingArrays::write(std::string_view filename,
+                    const Network *network) const
+{
+  FILE *stream = fopen(std::string(filename).c_str(), "wb");
+  if (stream == nullptr)
+    throw FileNotWritable(filename);
+  const char magic[8] = {'O','S','T','A','T','A','R','R'};
+  writeBytes(stream, magic, sizeof(magic), filename);
+  uint32_t header[2] = {version, value_count};
+  writeBytes(stream, header, sizeof(header), filename);
+  uint64_t pin_count = pins_.size();
+  writeBytes(stream, &pin_count, sizeof(pin_count), filename);
+  for (const Pin *pin : pins_) {
+    std::string name = network->pathName(pin);
+    uint32_t length = name.size();
+    writeBytes(stream, &length, sizeof(length), filename);
+    writeBytes(stream, name.data(), length, filename);
+  }
+  for (const std::vector<float> *values : {&slacks_, &arrivals_,
+                                           &requireds_, &slews_})
+    writeBytes(stream, values->data(), values->size() * sizeof(float),
+               filename);
+  if (fclose(stream) != 0)
+    throw FileNotWritable(filename);
+}
+
+} // namespace sta
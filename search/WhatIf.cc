@@ -0,0 +1,110 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "WhatIf.hh"
+
+#include "Network.hh"
+#include "Sta.hh"
+
+namespace sta {
+
+WhatIf::WhatIf(Sta *sta) :
+  sta_(sta)
+{
+}
+
+void
+WhatIf::makeInstance(Instance *inst)
+{
+  edits_.push_back({Edit::make_instance, inst, nullptr, nullptr, nullptr});
+}
+
+void
+WhatIf::makeNet(Net *net)
+{
+  edits_.push_back({Edit::make_net, nullptr, nullptr, nullptr, net});
+}
+
+void
+WhatIf::replaceCell(Instance *inst)
+{
+  Cell *from_cell = sta_->network()->cell(inst);
+  edits_.push_back({Edit::replace_cell, inst, from_cell, nullptr, nullptr});
+}
+
+void
+WhatIf::connectPin(Pin *pin)
+{
+  const Network *network = sta_->network();
+  edits_.push_back({Edit::connect_pin, network->instance(pin), nullptr,
+                    network->port(pin), nullptr});
+}
+
+void
+WhatIf::disconnectPin(Pin *pin)
+{
+  const Network *network = sta_->network();
+  Net *net = network->net(pin);
+  // Top level port pins are connected through their term.
+  if (net == nullptr) {
+    Term *term = network->term(pin);
+    if (term)
+      net = network->net(term);
+  }
+  // Disconnecting an unconnected pin does not change the network.
+  if (net)
+    edits_.push_back({Edit::disconnect_pin, network->instance(pin), nullptr,
+                      network->port(pin), net});
+}
+
+void
+WhatIf::undo()
+{
+  for (auto itr = edits_.rbegin(); itr != edits_.rend(); itr++) {
+    const EditRecord &record = *itr;
+    switch (record.edit) {
+    case Edit::make_instance:
+      sta_->deleteInstance(record.inst);
+      break;
+    case Edit::make_net:
+      sta_->deleteNet(record.net);
+      break;
+    case Edit::replace_cell:
+      sta_->replaceCell(record.inst, record.cell);
+      break;
+    case Edit::connect_pin: {
+      Pin *pin = sta_->network()->findPin(record.inst, record.port);
+      if (pin)
+        sta_->disconnectPin(pin);
+      break;
+    }
+    case Edit::disconnect_pin:
+      sta_->connectPin(record.inst, record.port, record.net);
+      break;
+    }
+  }
+  edits_.clear();
+}
+
+} // namespace sta
@@ -0,0 +1,70 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <vector>
+
+#include "NetworkClass.hh"
+
+namespace sta {
+
+class Sta;
+
+// Journal of the network edits made in a what-if session so they can
+// be undone when the session is discarded.
+// Pins are recorded by instance and port and found again on undo
+// because undoing a later edit can delete and remake them.
+class WhatIf
+{
+public:
+  WhatIf(Sta *sta);
+  void makeInstance(Instance *inst);
+  void makeNet(Net *net);
+  // Call before the cell is replaced.
+  void replaceCell(Instance *inst);
+  void connectPin(Pin *pin);
+  // Call before the pin is disconnected.
+  void disconnectPin(Pin *pin);
+  // Undo the edits in reverse order.
+  void undo();
+
+protected:
+  enum class Edit { make_instance, make_net, replace_cell,
+                    connect_pin, disconnect_pin };
+
+  struct EditRecord
+  {
+    Edit edit;
+    Instance *inst;
+    Cell *cell;
+    Port *port;
+    Net *net;
+  };
+
+  Sta *sta_;
+  std::vector<EditRecord> edits_;
+};
+
+} // namespace sta
@@ -456,6 +456,35 @@ proc write_stats { filename } {
 
 ################################################################
 
+define_cmd_args "start_profile" {} \
+  -help {The `start_profile` command clears the profile and starts timing the levelize, delay calculation, arrival, required, path group and path report phases, the levels of the parallel breadth first searches, the batches run by each worker thread and the time spent waiting for search, delay calculation and parasitics locks. Use `write_profile` to write the profile.}
+
+proc start_profile { args } {
+  check_argc_eq0 "start_profile" $args
+  set_profile_enabled 1
+}
+
+define_cmd_args "stop_profile" {} \
+  -help {The `stop_profile` command stops recording the profile started by `start_profile`.}
+
+proc stop_profile { args } {
+  check_argc_eq0 "stop_profile" $args
+  set_profile_enabled 0
+}
+
+define_cmd_args "write_profile" {filename} \
+  -help {The `write_profile` command writes the profile recorded since `start_profile` as Chrome trace event json that can be viewed with a trace viewer such as Perfetto or chrome://tracing. Phases are complete events on the thread that ran them. Worker thread busy/idle time and lock wait counts and times are counter events.} \
+  -arg_help {
+    filename {The json filename to write.}
+  }
+
+proc write_profile { args } {
+  check_argc_eq1 "write_profile" $args
+  write_profile_cmd [file nativename [lindex $args 0]]
+}
+
+################################################################
+
 # Begin/end logging all output to a file.
 define_cmd_args "log_begin" { filename } \
   -help {The `log_begin` command copies all subsequent command output to a file until `log_end` is called.} \
@@ -0,0 +1,70 @@
+# Reports after read_checkpoint match reports from delay calculation,
+# including slew annotations and incremental changes.
+source helpers.tcl
+
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+
+proc read_constraints {} {
+  create_clock -name clk -period 500 {clk1 clk2 clk3}
+  set_input_delay -clock clk 1 {in1 in2}
+  set_output_delay -clock clk 1 out
+  read_spef reg1_asap7.spef
+}
+
+proc report_design {} {
+  with_output_to_variable report {
+    report_checks -path_delay min_max -group_path_count 5 \
+      -fields {slew cap input_pins} -digits 4
+  }
+  return $report
+}
+
+proc compare_reports { label fresh restored } {
+  if { $restored == $fresh } {
+    puts "$label report matches fresh report"
+  } else {
+    puts "$label report does not match fresh report"
+    puts $fresh
+    puts $restored
+  }
+}
+
+read_constraints
+set_assigned_transition 20 u1/A
+set fresh [report_design]
+set checkpoint_file [make_result_file checkpoint.bin]
+write_checkpoint $checkpoint_file
+
+# Read the design constraints again without the slew annotation;
+# the checkpoint restores it.
+sta::clear_sta
+read_constraints
+read_checkpoint $checkpoint_file
+compare_reports "checkpoint" $fresh [report_design]
+
+# Incremental update of the restored delays.
+set_load 5 out
+set restored [report_design]
+sta::delays_invalid
+compare_reports "incremental" [report_design] $restored
+
+# A checkpoint read with different constraints is rejected.
+sta::clear_sta
+read_constraints
+set_input_delay -clock clk 2 in1
+catch { read_checkpoint $checkpoint_file } error
+puts [string map [list $checkpoint_file checkpoint.bin] $error]
+
+# A checkpoint from a different design is rejected.
+sta::clear_sta
+make_net u3z
+make_instance u3 BUFx2_ASAP7_75t_R
+disconnect_pin u1z u2/B
+connect_pin u1z u3/A
+connect_pin u3z u3/Y
+connect_pin u3z u2/B
+read_constraints
+catch { read_checkpoint $checkpoint_file } error
+puts [string map [list $checkpoint_file checkpoint.bin] $error]
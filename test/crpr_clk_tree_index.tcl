@@ -0,0 +1,54 @@
+# CRPR and common pins found with the clock tree index match the
+# level walk on a reconvergent clock tree with a generated clock.
+source helpers.tcl
+read_liberty asap7_small.lib.gz
+read_verilog crpr_clk_tree_index.v
+link_design crpr_clk_tree_index
+
+create_clock -name clk -period 500 clk
+create_generated_clock -name div -source [get_pins rdiv/CLK] -divide_by 2 \
+  [get_pins rdiv/Q]
+set_propagated_clock [all_clocks]
+set_input_delay -clock clk 1 in1
+set_output_delay -clock clk 1 {out1 out2}
+set_timing_derate -early 0.9
+set_timing_derate -late 1.1
+set sta_crpr_enabled 1
+set sta_report_checks_cache_size 0
+
+# The crpr debug reports the common pin of each check.
+proc crpr_report { use_index } {
+  sta::set_crpr_clk_tree_index $use_index
+  sta::set_debug crpr 2
+  with_output_to_variable report {
+    report_checks -path_delay min_max -group_path_count 100 \
+      -format full_clock_expanded -digits 4
+  }
+  sta::set_debug crpr 0
+  return $report
+}
+
+set index_report [crpr_report 1]
+set walk_report [crpr_report 0]
+sta::set_crpr_clk_tree_index 1
+if { $index_report == $walk_report } {
+  puts "clock tree index matches level walk"
+} else {
+  puts "clock tree index does not match level walk"
+  puts $index_report
+  puts $walk_report
+}
+
+# Common pin below the reconvergent pin and in the generated clock tree.
+foreach pin {a1/Y rdiv/Q} {
+  if { [string first "crpr pin $pin\n" $index_report] != -1 } {
+    puts "crpr pin $pin found"
+  } else {
+    puts "crpr pin $pin not found"
+  }
+}
+if { [string first "clock reconvergence pessimism" $index_report] != -1 } {
+  puts "clock reconvergence pessimism reported"
+} else {
+  puts "clock reconvergence pessimism not reported"
+}
@@ -0,0 +1,24 @@
+module crpr_clk_tree_index (clk, in1, out1, out2);
+  input clk, in1;
+  output out1, out2;
+  wire c0, c1, c2, c3, c4, c5, c6, div, divn, gc1, gc2, r1q, r2q, r3q;
+
+  BUFx2_ASAP7_75t_R b0 (.A(clk), .Y(c0));
+  BUFx2_ASAP7_75t_R b1 (.A(c0), .Y(c1));
+  BUFx2_ASAP7_75t_R b2 (.A(c0), .Y(c2));
+  // Reconvergent clock pin.
+  AND2x2_ASAP7_75t_R a1 (.A(c1), .B(c2), .Y(c3));
+  BUFx2_ASAP7_75t_R b3 (.A(c3), .Y(c4));
+  BUFx2_ASAP7_75t_R b4 (.A(c3), .Y(c5));
+  BUFx2_ASAP7_75t_R b5 (.A(c4), .Y(c6));
+  DFFHQx4_ASAP7_75t_R r1 (.D(in1), .CLK(c6), .Q(r1q));
+  DFFHQx4_ASAP7_75t_R r2 (.D(r1q), .CLK(c5), .Q(r2q));
+  // Divide by 2 generated clock.
+  DFFHQx4_ASAP7_75t_R rdiv (.D(divn), .CLK(c4), .Q(div));
+  INVx2_ASAP7_75t_R i1 (.A(div), .Y(divn));
+  BUFx2_ASAP7_75t_R b6 (.A(div), .Y(gc1));
+  BUFx2_ASAP7_75t_R b7 (.A(div), .Y(gc2));
+  DFFHQx4_ASAP7_75t_R r3 (.D(r2q), .CLK(gc1), .Q(r3q));
+  DFFHQx4_ASAP7_75t_R r4 (.D(r3q), .CLK(gc2), .Q(out1));
+  DFFHQx4_ASAP7_75t_R r5 (.D(r3q), .CLK(c5), .Q(out2));
+endmodule // crpr_clk_tree_index
@@ -0,0 +1,59 @@
+# Timing graph built with 4 threads matches 1 thread.
+source helpers.tcl
+
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+
+compare_thread_counts 4 {
+  # Delete the graph so it is built again.
+  sta::clear_sta
+  read_sdc ../examples/gcd_sky130hd.sdc
+  set_propagated_clock clk
+  read_spef ../examples/gcd_sky130hd.spef
+  report_checks -path_delay min_max -group_path_count 5 -digits 4
+  foreach pin [get_pins -hierarchical *] {
+    report_edges -from $pin
+  }
+  foreach port [get_ports *] {
+    report_edges -from $port
+  }
+}
+
+proc report_graph {} {
+  with_output_to_variable report {
+    report_checks -path_delay min_max -group_path_count 5 -digits 4
+    foreach pin [get_pins -hierarchical *] {
+      report_edges -from $pin
+    }
+  }
+  # Edges added by the edit are in a different order.
+  return [lsort [split $report "\n"]]
+}
+
+# Edit the graph built with 4 threads and compare it to a graph built
+# from the edited netlist.
+sta::set_thread_count 4
+sta::clear_sta
+read_sdc ../examples/gcd_sky130hd.sdc
+set_propagated_clock clk
+report_checks > /dev/null
+set loads [get_pins -of_objects [get_nets req_val] -filter "direction == input"]
+make_net req_val_buf
+make_instance req_val_buf sky130_fd_sc_hd__buf_1
+foreach load $loads {
+  disconnect_pin req_val $load
+  connect_pin req_val_buf $load
+}
+connect_pin req_val req_val_buf/A
+connect_pin req_val_buf req_val_buf/X
+set edited [report_graph]
+sta::set_thread_count 1
+sta::clear_sta
+read_sdc ../examples/gcd_sky130hd.sdc
+set_propagated_clock clk
+if { [report_graph] == $edited } {
+  puts "edited graph matches rebuilt graph"
+} else {
+  puts "edited graph does not match rebuilt graph"
+}
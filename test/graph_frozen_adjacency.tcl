@@ -0,0 +1,55 @@
+# sta_graph_frozen_adjacency timing matches the graph edge lists,
+# before and after a netlist edit.
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_output_delay -clock clk 1 out
+
+proc compare_frozen_adjacency {} {
+  global sta_graph_frozen_adjacency
+  set sta_graph_frozen_adjacency 0
+  find_timing -full_update
+  with_output_to_variable edge_lists {
+    report_checks -path_delay min_max -group_path_count 5 -digits 4
+  }
+  set sta_graph_frozen_adjacency 1
+  find_timing -full_update
+  with_output_to_variable frozen {
+    report_checks -path_delay min_max -group_path_count 5 -digits 4
+  }
+  if { $frozen == $edge_lists } {
+    puts "frozen adjacency matches edge lists"
+  } else {
+    puts "frozen adjacency does not match edge lists"
+    puts $edge_lists
+    puts $frozen
+  }
+}
+
+compare_frozen_adjacency
+
+# Insert a buffer with the adjacency frozen.
+make_net u3z
+make_instance u3 BUFx2_ASAP7_75t_R
+disconnect_pin u1z u2/B
+connect_pin u1z u3/A
+connect_pin u3z u3/Y
+connect_pin u3z u2/B
+with_output_to_variable after_edit {
+  report_checks -path_delay min_max -group_path_count 5 -digits 4
+}
+set sta_graph_frozen_adjacency 0
+find_timing -full_update
+with_output_to_variable after_edit_lists {
+  report_checks -path_delay min_max -group_path_count 5 -digits 4
+}
+if { $after_edit == $after_edit_lists } {
+  puts "frozen adjacency after edit matches edge lists"
+} else {
+  puts "frozen adjacency after edit does not match edge lists"
+}
+
+compare_frozen_adjacency
@@ -39,3 +39,30 @@ proc make_result_file { filename } {
 proc sort_objects { objects } {
   return [sta::sort_by_full_name $objects]
 }
+
+# Output of cmds run in the caller of compare_thread_counts.
+proc thread_count_output { thread_count cmds } {
+  sta::set_thread_count $thread_count
+  sta::redirect_string_begin
+  if { [catch { uplevel 2 $cmds } error] } {
+    sta::redirect_string_end
+    sta::set_thread_count 1
+    error "$thread_count threads failed: $error"
+  }
+  return [sta::redirect_string_end]
+}
+
+# Compare the output of cmds run with one thread and thread_count threads.
+# An error in cmds fails the test.
+proc compare_thread_counts { thread_count cmds } {
+  set serial [thread_count_output 1 $cmds]
+  set parallel [thread_count_output $thread_count $cmds]
+  sta::set_thread_count 1
+  if { $serial == $parallel } {
+    puts "$thread_count threads match 1 thread"
+  } else {
+    puts "$thread_count threads do not match 1 thread"
+    puts $serial
+    puts $parallel
+  }
+}
@@ -0,0 +1,44 @@
+# Levelize with 4 threads matches 1 thread.
+source helpers.tcl
+
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+
+compare_thread_counts 4 {
+  # Delete the graph so it is levelized again.
+  sta::clear_sta
+  read_sdc ../examples/gcd_sky130hd.sdc
+  set_propagated_clock clk
+  report_checks -path_delay min_max -group_path_count 5 -digits 4
+  foreach pin [get_pins -hierarchical *] {
+    sta::report_level $pin
+  }
+  foreach port [get_ports *] {
+    sta::report_level $port
+  }
+}
+
+# Levels increase along the graph edges that are not timing checks.
+sta::set_thread_count 4
+sta::clear_sta
+read_sdc ../examples/gcd_sky130hd.sdc
+report_checks > /dev/null
+set edge_count 0
+set level_errors 0
+foreach pin [get_pins -hierarchical *] {
+  foreach vertex [$pin vertices] {
+    set edge_iter [$vertex out_edge_iterator]
+    while {[$edge_iter has_next]} {
+      set edge [$edge_iter next]
+      if { ![sta::timing_role_is_check [$edge role]] } {
+        incr edge_count
+        if { [[$edge to] level] <= [$vertex level] } {
+          incr level_errors
+        }
+      }
+    }
+    $edge_iter finish
+  }
+}
+puts "edges checked [expr { $edge_count > 0 }] level errors $level_errors"
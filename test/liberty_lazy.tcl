@@ -0,0 +1,57 @@
+# read_liberty -lazy timing matches read_liberty.
+source helpers.tcl
+
+read_liberty -lazy liberty_retain.lib
+set lazy_lib [sta::find_liberty liberty_retain]
+puts "deferred cells before link [$lazy_lib deferred_cell_count]"
+read_verilog liberty_retain.v
+link_design top
+puts "deferred cells after link [$lazy_lib deferred_cell_count]"
+
+create_clock -name clk -period 10
+set_input_delay -clock clk 0 {in1 in2}
+set_output_delay -clock clk 0 {out1 out2}
+set_input_transition 0 {in1 in2}
+set_load 0 {out1 out2}
+
+with_output_to_variable lazy_report {
+  report_checks -path_delay min_max -digits 4 -fields {slew}
+}
+
+# Read an eager copy of the library with a different name.
+set stream [open liberty_retain.lib r]
+set lib_text [read $stream]
+close $stream
+regsub {library \(liberty_retain\)} $lib_text \
+  {library (liberty_retain_eager)} lib_text
+set eager_file [make_result_file liberty_lazy_eager.lib]
+set stream [open $eager_file w]
+puts -nonewline $stream $lib_text
+close $stream
+
+read_liberty $eager_file
+puts "eager cells [llength [get_lib_cells liberty_retain_eager/*]]"
+replace_cell u1 liberty_retain_eager/buf_retain
+replace_cell u2 liberty_retain_eager/buf_retain_no_slew
+with_output_to_variable eager_report {
+  report_checks -path_delay min_max -digits 4 -fields {slew}
+}
+
+if { $lazy_report == $eager_report } {
+  puts "lazy report matches eager"
+} else {
+  puts "lazy report does not match eager"
+  puts $lazy_report
+  puts $eager_report
+}
+
+# Cells that are not referenced are not read.
+read_liberty -lazy asap7_small.lib.gz
+set asap7_lib [sta::find_liberty asap7_small]
+puts "asap7 deferred cells [$asap7_lib deferred_cell_count]"
+sta::find_liberty_cell BUFx2_ASAP7_75t_R
+puts "asap7 deferred cells after find [$asap7_lib deferred_cell_count]"
+puts "asap7 inverters [llength [get_lib_cells asap7_small/INV*]]"
+puts "asap7 deferred cells after get_lib_cells [$asap7_lib deferred_cell_count]"
+report_checks -path_delay max -digits 4 > /dev/null
+puts "asap7 deferred cells after report [$asap7_lib deferred_cell_count]"
@@ -0,0 +1,48 @@
+# Timing with liberty tables shared between scene libraries
+# matches for 1 and 4 threads.
+source helpers.tcl
+
+read_liberty ../examples/asap7_small_ff.lib.gz
+read_liberty ../examples/asap7_small_ss.lib.gz
+read_verilog ../examples/reg1_asap7.v
+link_design top
+
+read_sdc -mode mode1 ../examples/mcmm2_mode1.sdc
+read_sdc -mode mode2 ../examples/mcmm2_mode2.sdc
+
+read_spef -name reg1_ff ../examples/reg1_asap7.spef
+read_spef -name reg1_ss ../examples/reg1_asap7_ss.spef
+
+define_scene scene1 -mode mode1 -liberty asap7_small_ff -spef reg1_ff
+define_scene scene2 -mode mode2 -liberty asap7_small_ss -spef reg1_ss
+
+compare_thread_counts 4 {
+  find_timing -full_update
+  report_checks -path_delay min_max -group_path_count 4 -digits 4 \
+    -fields {slew cap input_pins}
+}
+
+# Every table of a renamed copy of a library is shared with the
+# original.
+set stream [open ../examples/asap7_small_ff.lib.gz r]
+zlib push gunzip $stream
+set lib_text [read $stream]
+close $stream
+regsub {library \(asap7_small_ff\)} $lib_text \
+  {library (asap7_small_ff_copy)} lib_text
+set copy_file [make_result_file liberty_table_sharing_copy.lib]
+set stream [open $copy_file w]
+puts -nonewline $stream $lib_text
+close $stream
+
+set table_count [sta::liberty_table_count]
+set shared_count [sta::liberty_table_shared_count]
+puts "tables shared between libraries [expr { $shared_count > 0 }]"
+read_liberty $copy_file
+set copy_table_count [expr [sta::liberty_table_count] - $table_count]
+set copy_shared_count [expr [sta::liberty_table_shared_count] - $shared_count]
+if { $copy_table_count > 0 && $copy_shared_count == $copy_table_count } {
+  puts "library copy tables are all shared"
+} else {
+  puts "library copy tables $copy_table_count shared $copy_shared_count"
+}
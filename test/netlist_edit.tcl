@@ -0,0 +1,74 @@
+# Reports after batched network edits match a full timing update.
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_output_delay -clock clk 1 out
+read_spef reg1_asap7.spef
+
+proc report_design {} {
+  with_output_to_variable report {
+    report_checks -path_delay min_max -group_path_count 5 \
+      -fields {slew cap input_pins} -digits 4
+  }
+  return $report
+}
+
+proc compare_full_update { label } {
+  set batched [report_design]
+  find_timing -full_update
+  set full [report_design]
+  if { $batched == $full } {
+    puts "$label report matches full update"
+  } else {
+    puts "$label report does not match full update"
+    puts $full
+    puts $batched
+  }
+  return $batched
+}
+
+set original [report_design]
+
+# Insert buffers on u1z and r1q in nested batches.
+begin_netlist_edit
+make_net u3z
+make_instance u3 BUFx2_ASAP7_75t_R
+disconnect_pin u1z u2/B
+connect_pin u1z u3/A
+connect_pin u3z u3/Y
+connect_pin u3z u2/B
+# Timing in a batch sees the edits made so far.
+if { [report_design] != $original } {
+  puts "report in batch sees edits"
+}
+begin_netlist_edit
+make_net u4z
+make_instance u4 BUFx2_ASAP7_75t_R
+disconnect_pin r1q u2/A
+connect_pin r1q u4/A
+connect_pin u4z u4/Y
+connect_pin u4z u2/A
+end_netlist_edit
+end_netlist_edit
+compare_full_update "insert"
+
+# Remove the buffers in a batch.
+begin_netlist_edit
+disconnect_pin u3z u2/B
+disconnect_pin u4z u2/A
+delete_instance u3
+delete_instance u4
+delete_net u3z
+delete_net u4z
+connect_pin u1z u2/B
+connect_pin r1q u2/A
+end_netlist_edit
+set removed [compare_full_update "remove"]
+if { $removed == $original } {
+  puts "remove report matches original"
+} else {
+  puts "remove report does not match original"
+}
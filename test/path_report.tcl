@@ -0,0 +1,94 @@
+# write_path_report_json converts the binary path report to the values
+# reported by report_checks -format json, escapes names and rejects
+# corrupted files.
+source helpers.tcl
+
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_output_delay -clock clk 1 out
+read_spef reg1_asap7.spef
+
+proc read_lines { filename } {
+  set stream [open $filename r]
+  set lines [split [read $stream] "\n"]
+  close $stream
+  return $lines
+}
+
+# Lines of the converted json that are in report_checks -format json.
+proc compare_json { path_args } {
+  set bin_file [make_result_file path_report.bin]
+  set json_file [make_result_file path_report.json]
+  write_path_report {*}$path_args $bin_file
+  write_path_report_json $bin_file $json_file
+  with_output_to_variable report {
+    report_checks {*}$path_args -format json
+  }
+  set report_lines {}
+  foreach line [split $report "\n"] {
+    dict set report_lines [string trim $line] 1
+  }
+  set compared 0
+  set missing 0
+  foreach line [read_lines $json_file] {
+    set line [string trim $line]
+    if { [regexp {^"(startpoint|endpoint|pin|arrival|slew|required_time|slack)"} \
+            $line] } {
+      incr compared
+      if { ![dict exists $report_lines $line] } {
+        puts "missing $line"
+        incr missing
+      }
+    }
+  }
+  if { $compared > 0 && $missing == 0 } {
+    puts "$path_args json matches report_checks"
+  }
+}
+
+compare_json {-path_delay max}
+compare_json {-path_delay min_max -group_path_count 5}
+
+# Names with quotes are escaped.
+make_net {u3"z}
+make_instance u3 BUFx2_ASAP7_75t_R
+disconnect_pin u1z u2/B
+connect_pin u1z u3/A
+connect_pin {u3"z} u3/Y
+connect_pin {u3"z} u2/B
+set bin_file [make_result_file path_report.bin]
+set json_file [make_result_file path_report.json]
+write_path_report -through u3/Y $bin_file
+write_path_report_json $bin_file $json_file
+set net_lines {}
+foreach line [read_lines $json_file] {
+  if { [string first "\"net\": " $line] != -1
+       && [string first "u3" $line] != -1 } {
+    lappend net_lines [string trim $line]
+  }
+}
+foreach line [lsort -unique $net_lines] {
+  puts $line
+}
+
+# Corrupted files.
+proc write_bytes { filename bytes } {
+  set stream [open $filename wb]
+  puts -nonewline $stream $bytes
+  close $stream
+}
+
+set header [binary format a8n OSTAPRPT 1]
+# String longer than the file.
+write_bytes $bin_file [binary format a*cn $header 0 0x7ffffff0]
+catch { write_path_report_json $bin_file $json_file } error
+puts [string map [list $bin_file path_report.bin] $error]
+# Stage count larger than the file.
+write_bytes $bin_file \
+  [binary format a*cn6nx24 $header 1 {0 0 0 0 0 0} 0x7ffffff0]
+catch { write_path_report_json $bin_file $json_file } error
+puts [string map [list $bin_file path_report.bin] $error]
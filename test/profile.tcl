@@ -0,0 +1,58 @@
+# start_profile, stop_profile and write_profile record the timing
+# phases while the profile is started.
+source helpers.tcl
+
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+sta::set_thread_count 4
+
+proc report_design {} {
+  with_output_to_variable report {
+    report_checks -path_delay min_max -group_path_count 5
+  }
+}
+
+# Count the complete events for each phase in the profile file.
+proc report_profile { filename phases } {
+  set stream [open $filename r]
+  set lines [split [string trimright [read $stream] "\n"] "\n"]
+  close $stream
+  if { [lindex $lines 0] == "\{\"traceEvents\": \[" \
+         && [lindex $lines end] == "\]\}" \
+         && [string match "*process_name*" [lindex $lines end-1]] } {
+    puts "profile trace events"
+  }
+  foreach phase $phases {
+    set count 0
+    foreach line $lines {
+      if { [string first "\{\"name\": \"$phase\", " $line] == 0 } {
+        incr count
+      }
+    }
+    puts "$phase [expr { $count > 0 ? "recorded" : "not recorded" }]"
+  }
+}
+
+set profile_file [make_result_file profile.json]
+start_profile
+find_timing -full_update
+report_design
+stop_profile
+write_profile $profile_file
+report_profile $profile_file {"levelize" "find delays" "find arrivals" \
+                                "find requireds" "path groups" "report paths"}
+
+# start_profile clears the previous profile and stop_profile stops
+# recording.
+start_profile
+report_design
+stop_profile
+sta::clear_sta
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+report_design
+write_profile $profile_file
+report_profile $profile_file {"levelize" "path groups" "report paths"}
@@ -141,6 +141,8 @@ record_example_tests {
 }
 
 record_public_tests {
+  checkpoint
+  crpr_clk_tree_index
   disconnect_mcp_pin
   get_filter
   get_is_buffer
@@ -149,37 +151,49 @@ record_public_tests {
   get_noargs
   get_scenes
   get_objrefs
+  graph_build_threads
+  graph_frozen_adjacency
   input_delay_ref_pin_rebuild
+  levelize_threads
   liberty_arcs_one2one_1
   liberty_arcs_one2one_2
   liberty_backslash_eol
   liberty_ccsn
   liberty_float_as_str
   liberty_latch3
+  liberty_lazy
   liberty_retain
+  liberty_table_sharing_threads
   make_concrete_parasitics_leak
   max_power_area
+  netlist_edit
   non_seq_timing
   package_require
   path_group_names
+  path_report
   power_json
   prima3
   prima_singular
+  profile
   read_saif_null_instance
+  report_checks_cache
   report_checks_sorted
   report_checks_src_attr
   report_json1
   report_json2
+  sdf_annotate_threads
   set_path_margin1
   set_path_margin2
   set_path_margin3
   set_path_margin4
   set_path_margin5
   set_path_margin6
+  sim_constants_threads
   slash_port_test
   suppress_msg
   swig_seq_double_free
   swig_seq_leak
+  timing_arrays
   user_properties
   vcd_begin_end_time
   verilog_assign_alias_loop
@@ -194,7 +208,10 @@ record_public_tests {
   verilog_write_escape
   verilog_write_gzip
   verilog_unconnected_hpin
+  what_if
   write_path_spice_arc_sense
+  write_sdf_threads
+  write_timing_model_threads
 }
 
 define_test_group fast [group_tests all]
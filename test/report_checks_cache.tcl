@@ -0,0 +1,58 @@
+# Reports from the report_checks cache match uncached reports,
+# including after a timing change.
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_output_delay -clock clk 1 out
+
+set queries {
+  {-path_delay min_max -digits 4}
+  {-from in1 -format full_clock}
+  {-through u1/Y -fields {slew cap}}
+  {-to out -path_delay max}
+}
+
+proc report_queries { cache_size } {
+  global sta_report_checks_cache_size queries
+  set sta_report_checks_cache_size $cache_size
+  with_output_to_variable report {
+    # Report each query twice so the second report comes from the cache.
+    foreach query $queries {
+      report_checks {*}$query
+      report_checks {*}$query
+    }
+  }
+  return $report
+}
+
+proc compare_cache { label } {
+  global queries
+  # Cached reports first so stale cache entries would be reported.
+  set cached [report_queries [llength $queries]]
+  set uncached [report_queries 0]
+  if { $cached == $uncached } {
+    puts "$label cached report matches uncached"
+  } else {
+    puts "$label cached report does not match uncached"
+    puts $uncached
+    puts $cached
+  }
+  with_output_to_variable batch {
+    report_checks_batch [concat $queries $queries]
+  }
+  if { $batch == $uncached } {
+    puts "$label batch report matches uncached"
+  } else {
+    puts "$label batch report does not match uncached"
+  }
+}
+
+compare_cache "initial"
+# Reports cached before a timing change are not reused.
+report_queries [llength $queries]
+set_input_delay -clock clk 20 {in1 in2}
+set_load 5 out
+compare_cache "after edit"
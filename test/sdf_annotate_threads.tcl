@@ -0,0 +1,46 @@
+# SDF annotation with 4 threads matches 1 thread and the annotated
+# delays match the calculated delays the SDF was written from.
+source helpers.tcl
+
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+set_propagated_clock clk
+read_spef ../examples/gcd_sky130hd.spef
+
+set sdf_file [make_result_file sdf_annotate_threads.sdf]
+write_sdf -digits 6 -no_timestamp -no_version $sdf_file
+with_output_to_variable calculated {
+  report_checks -path_delay min_max -group_path_count 5 -digits 3
+}
+
+compare_thread_counts 4 {
+  read_sdf $sdf_file
+  report_annotated_delay -cell -net -from_in_ports -to_out_ports
+  report_annotated_check -setup -hold
+  report_checks -path_delay min_max -group_path_count 5 -digits 4
+}
+
+sta::set_thread_count 4
+read_sdf $sdf_file
+with_output_to_variable annotated {
+  report_checks -path_delay min_max -group_path_count 5 -digits 3
+}
+if { $annotated == $calculated } {
+  puts "annotated report matches calculated report"
+} else {
+  puts "annotated report does not match calculated report"
+  puts $calculated
+  puts $annotated
+}
+# Annotated delays do not change with the output loads.
+set_load 0.5 [all_outputs]
+with_output_to_variable loaded {
+  report_checks -path_delay min_max -group_path_count 5 -digits 3
+}
+if { $loaded == $annotated } {
+  puts "annotated report ignores output loads"
+} else {
+  puts "annotated report changes with output loads"
+}
@@ -0,0 +1,32 @@
+# Constant propagation with 4 threads matches 1 thread.
+source helpers.tcl
+
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+
+compare_thread_counts 4 {
+  set_case_analysis 1 reset
+  set_case_analysis 0 req_val
+  foreach pin [get_pins -hierarchical *] {
+    puts "[get_full_name $pin] [sta::pin_sim_logic_value $pin]"
+  }
+  report_checks -path_delay min_max -group_path_count 5 -digits 4
+  unset_case_analysis {reset req_val}
+}
+
+# Constants propagate past the case analysis ports.
+sta::set_thread_count 4
+set_case_analysis 1 reset
+set_case_analysis 0 req_val
+puts "reset [sta::pin_sim_logic_value [get_ports reset]]"
+puts "req_val [sta::pin_sim_logic_value [get_ports req_val]]"
+set constant_count 0
+foreach pin [get_pins -hierarchical -filter "direction == output" *] {
+  set value [sta::pin_sim_logic_value $pin]
+  if { $value == "0" || $value == "1" } {
+    incr constant_count
+  }
+}
+puts "constant cell outputs [expr { $constant_count > 0 }]"
@@ -0,0 +1,79 @@
+# get_timing_arrays with 4 threads matches 1 thread and
+# write_timing_arrays writes the same values.
+source helpers.tcl
+
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_output_delay -clock clk 1 out
+read_spef reg1_asap7.spef
+
+set pins [get_pins -hierarchical *]
+compare_thread_counts 4 {
+  puts [get_timing_arrays $pins]
+  puts [get_timing_arrays -all_endpoints]
+}
+
+# Read the write_timing_arrays file back.
+proc read_timing_arrays { filename } {
+  set stream [open $filename rb]
+  set bytes [read $stream]
+  close $stream
+  binary scan $bytes a8nnm magic version value_count pin_count
+  set offset 24
+  set names {}
+  for {set i 0} {$i < $pin_count} {incr i} {
+    binary scan $bytes @${offset}n length
+    binary scan $bytes @[expr $offset + 4]a$length name
+    lappend names $name
+    incr offset [expr 4 + $length]
+  }
+  set array_size [expr $pin_count * $value_count]
+  set arrays {}
+  for {set i 0} {$i < 4} {incr i} {
+    binary scan $bytes @${offset}f$array_size values
+    lappend arrays $values
+    incr offset [expr $array_size * 4]
+  }
+  puts "$magic version $version values $value_count"
+  return [list $names $arrays]
+}
+
+proc compare_arrays { label pins arrays filename } {
+  lassign [read_timing_arrays $filename] names file_arrays
+  set pin_names {}
+  foreach pin $pins {
+    lappend pin_names [get_full_name $pin]
+  }
+  if { $names == $pin_names } {
+    puts "$label pin names match"
+  } else {
+    puts "$label pin names do not match"
+  }
+  set match 1
+  foreach array $arrays file_array $file_arrays {
+    if { [llength $array] != [expr [llength $pins] * 4] } {
+      set match 0
+    }
+    foreach value $array file_value $file_array {
+      if { [format %.6e $value] != [format %.6e $file_value] } {
+        set match 0
+      }
+    }
+  }
+  if { $match } {
+    puts "$label file values match get_timing_arrays"
+  } else {
+    puts "$label file values do not match get_timing_arrays"
+  }
+}
+
+set filename [make_result_file timing_arrays.bin]
+write_timing_arrays -pins $pins $filename
+compare_arrays "pins" $pins [get_timing_arrays $pins] $filename
+write_timing_arrays -all_endpoints $filename
+compare_arrays "endpoints" [sta::endpoints] \
+  [get_timing_arrays -all_endpoints] $filename
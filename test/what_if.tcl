@@ -0,0 +1,72 @@
+# discard_what_if restores the original report and commit_what_if
+# keeps the edited report.
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_output_delay -clock clk 1 out
+read_spef reg1_asap7.spef
+# Save delays from multiple delay calculation threads.
+sta::set_thread_count 4
+
+proc report_design {} {
+  with_output_to_variable report {
+    report_checks -path_delay min_max -group_path_count 5 \
+      -fields {slew cap input_pins} -digits 4
+  }
+  return $report
+}
+
+proc insert_buffer {} {
+  make_net u3z
+  make_instance u3 BUFx2_ASAP7_75t_R
+  disconnect_pin u1z u2/B
+  connect_pin u1z u3/A
+  connect_pin u3z u3/Y
+  connect_pin u3z u2/B
+}
+
+proc compare_reports { label expected actual } {
+  if { $actual == $expected } {
+    puts "$label report matches"
+  } else {
+    puts "$label report does not match"
+    puts $expected
+    puts $actual
+  }
+}
+
+set original [report_design]
+begin_what_if
+insert_buffer
+set edited [report_design]
+if { $edited != $original } {
+  puts "what-if edit changes report"
+}
+discard_what_if
+compare_reports "discard" $original [report_design]
+sta::delays_invalid
+compare_reports "discard full update" $original [report_design]
+
+# A top level port disconnected in a session is reconnected.
+begin_what_if
+disconnect_pin out out
+discard_what_if
+compare_reports "port discard" $original [report_design]
+
+# The analysis points cannot change in a session.
+begin_what_if
+catch { set_operating_conditions -analysis_type bc_wc } error
+puts $error
+discard_what_if
+compare_reports "analysis type discard" $original [report_design]
+
+begin_what_if
+insert_buffer
+report_design
+commit_what_if
+compare_reports "commit" $edited [report_design]
+sta::delays_invalid
+compare_reports "commit full update" $edited [report_design]
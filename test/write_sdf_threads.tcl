@@ -0,0 +1,36 @@
+# write_sdf with 4 threads matches 1 thread.
+source helpers.tcl
+
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+set_propagated_clock clk
+read_spef ../examples/gcd_sky130hd.spef
+
+set sdf_file [make_result_file write_sdf_threads.sdf]
+compare_thread_counts 4 {
+  write_sdf -no_timestamp -no_version $sdf_file
+  report_file $sdf_file
+}
+
+# Compressed files are byte for byte identical.
+proc write_sdf_gzip_bytes { thread_count filename } {
+  sta::set_thread_count $thread_count
+  write_sdf -gzip -no_timestamp -no_version $filename
+  sta::set_thread_count 1
+  set stream [open $filename r]
+  fconfigure $stream -translation binary
+  set bytes [read $stream]
+  close $stream
+  return $bytes
+}
+
+set sdf_gz_file [make_result_file write_sdf_threads.sdf.gz]
+set serial [write_sdf_gzip_bytes 1 $sdf_gz_file]
+set parallel [write_sdf_gzip_bytes 4 $sdf_gz_file]
+if { $parallel == $serial } {
+  puts "4 threads gzip matches 1 thread"
+} else {
+  puts "4 threads gzip does not match 1 thread"
+}
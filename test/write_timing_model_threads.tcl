@@ -0,0 +1,33 @@
+# write_timing_model -threads 4 matches -threads 1.
+source helpers.tcl
+
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+set_propagated_clock clk
+read_spef ../examples/gcd_sky130hd.spef
+
+set model_file1 [make_result_file write_timing_model_threads1.lib]
+set model_file4 [make_result_file write_timing_model_threads4.lib]
+write_timing_model -threads 1 $model_file1
+write_timing_model -threads 4 $model_file4
+
+proc read_text { filename } {
+  set stream [open $filename r]
+  set text [read $stream]
+  close $stream
+  return $text
+}
+
+if { [read_text $model_file1] == [read_text $model_file4] } {
+  puts "write_timing_model -threads 4 matches -threads 1"
+} else {
+  puts "write_timing_model -threads 4 does not match -threads 1"
+}
+
+# The model has the ports of the block.
+read_liberty $model_file4
+foreach port {clk reset req_val resp_val} {
+  puts "model pin $port [llength [get_lib_pins -quiet gcd/gcd/$port]]"
+}
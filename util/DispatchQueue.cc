@@ -4,16 +4,44 @@
 // Original article: https://embeddedartistry.com/blog/2017/2/1/dispatch-queues?rq=dispatch
 //
 // Modified for OpenSTA to use C++20 non-spinning DynamicLatch for synchronization.
+// Modified for OpenSTA to run batches of tasks and index ranges with
+// worker threads that claim work with an atomic index.
+// Modified for OpenSTA to queue dispatched tasks on per worker deques
+// that idle workers steal from.
 
 #include "DispatchQueue.hh"
 
+#include <algorithm>
+#include <string>
+
+#include "Error.hh"
+#include "Machine.hh"
+#include "Profiler.hh"
+
 namespace sta {
 
-DispatchQueue::DispatchQueue(size_t thread_count) :
-  threads_(thread_count)
+// Spin iterations before an idle thread sleeps.
+static constexpr int spin_count = 2000;
+// Ranges claimed per thread when the caller does not pick a grain.
+static constexpr size_t ranges_per_thread = 8;
+// Queue of the worker thread running this thread's tasks.
+static thread_local const DispatchQueue *worker_queue = nullptr;
+// Worker thread index in worker_queue.
+static thread_local size_t worker_thread = 0;
+
+static inline void
+spinPause()
 {
-  for(size_t i = 0; i < thread_count; i++)
-    threads_[i] = std::thread(&DispatchQueue::dispatch_thread_handler, this, i);
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+DispatchQueue::DispatchQueue(size_t thread_count)
+{
+  startThreads(thread_count);
 }
 
 DispatchQueue::~DispatchQueue()
@@ -21,14 +49,29 @@ DispatchQueue::~DispatchQueue()
   terminateThreads();
 }
 
+void
+DispatchQueue::startThreads(size_t thread_count)
+{
+  uint64_t generation = generation_.load(std::memory_order_acquire);
+  deques_.resize(thread_count);
+  for (size_t i = 0; i < thread_count; i++)
+    deques_[i] = std::make_unique<TaskDeque>();
+  next_deque_ = 0;
+  threads_.resize(thread_count);
+  for (size_t i = 0; i < thread_count; i++)
+    threads_[i] = std::thread(&DispatchQueue::workerLoop, this, i, generation);
+}
+
 void
 DispatchQueue::terminateThreads()
 {
+  // Dispatched tasks are run before the threads quit.
+  if (!threads_.empty())
+    pending_task_count_latch_.wait();
   // Signal to dispatch threads that it's time to wrap up
-  std::unique_lock<std::mutex> lock(lock_);
-  quit_ = true;
-  lock.unlock();
-  cv_.notify_all();
+  quit_.store(true, std::memory_order_release);
+  generation_.fetch_add(1, std::memory_order_release);
+  wakeWorkers();
 
   // Wait for threads to finish before we exit
   for (auto &thread : threads_) {
@@ -36,18 +79,16 @@ DispatchQueue::terminateThreads()
       thread.join();
     }
   }
-  quit_ = false;
+  threads_.clear();
+  deques_.clear();
+  quit_.store(false, std::memory_order_release);
 }
 
 void
 DispatchQueue::setThreadCount(size_t thread_count)
 {
   terminateThreads();
-
-  threads_.resize(thread_count);
-  for(size_t i = 0; i < thread_count; i++) {
-    threads_[i] = std::thread(&DispatchQueue::dispatch_thread_handler, this, i);
-  }
+  startThreads(thread_count);
 }
 
 size_t
@@ -57,59 +98,266 @@ DispatchQueue::getThreadCount() const
 }
 
 void
-DispatchQueue::finishTasks()
+DispatchQueue::setCpuAffinity(bool cpu_affinity)
 {
-  pending_task_count_latch_.wait();
+  if (cpu_affinity != cpu_affinity_) {
+    cpu_affinity_ = cpu_affinity;
+    // Restart the threads to bind or unbind them.
+    setThreadCount(threads_.size());
+  }
 }
 
+// The worker threads read tasks_ while a batch runs, so tasks cannot
+// defer more tasks or start another batch.
 void
-DispatchQueue::dispatch(const fp_t& op)
+DispatchQueue::checkCaller(const char *func) const
 {
-  std::unique_lock<std::mutex> lock(lock_);
-  q_.push(op);
-  pending_task_count_latch_.countUp();
+  if (worker_queue == this)
+    criticalError(1611, std::string("DispatchQueue::") + func
+                  + " called from a dispatch queue task");
+}
 
-  // Manual unlocking is done before notifying, to avoid waking up
-  // the waiting thread only to block again (see notify_one for details)
-  lock.unlock();
-  cv_.notify_one();
+void
+DispatchQueue::dispatch(const Task &task)
+{
+  if (threads_.empty())
+    task(0);
+  else
+    queueTask(Task(task));
 }
 
 void
-DispatchQueue::dispatch(fp_t&& op)
+DispatchQueue::dispatch(Task &&task)
+{
+  if (threads_.empty())
+    task(0);
+  else
+    queueTask(std::move(task));
+}
+
+// Tasks dispatched by a task go on the deque of the worker running it
+// so they are run next by that worker. Tasks dispatched by the caller
+// are spread over the worker deques.
+void
+DispatchQueue::queueTask(Task &&task)
 {
-  std::unique_lock<std::mutex> lock(lock_);
-  q_.push(std::move(op));
   pending_task_count_latch_.countUp();
+  size_t index = (worker_queue == this)
+    ? worker_thread
+    : next_deque_++ % deques_.size();
+  TaskDeque *deque = deques_[index].get();
+  {
+    std::lock_guard<std::mutex> lock(deque->lock);
+    deque->tasks.push_back(std::move(task));
+  }
+  wake_.fetch_add(1, std::memory_order_release);
+  wake_.notify_one();
+}
 
-  // Manual unlocking is done before notifying, to avoid waking up
-  // the waiting thread only to block again (see notify_one for details)
-  lock.unlock();
-  cv_.notify_one();
+void
+DispatchQueue::wakeWorkers()
+{
+  wake_.fetch_add(1, std::memory_order_release);
+  wake_.notify_all();
 }
 
 void
-DispatchQueue::dispatch_thread_handler(size_t i)
+DispatchQueue::deferTask(const Task &task)
 {
-  std::unique_lock<std::mutex> lock(lock_);
+  checkCaller("deferTask");
+  tasks_.push_back(task);
+}
 
-  do {
-    // Wait until we have data or a quit signal
-    cv_.wait(lock, [this] { return (!q_.empty() || quit_); } );
+void
+DispatchQueue::deferTask(Task &&task)
+{
+  checkCaller("deferTask");
+  tasks_.push_back(std::move(task));
+}
 
-    //after wait, we own the lock
-    if (!quit_ && !q_.empty()) {
-      auto op = std::move(q_.front());
-      q_.pop();
+void
+DispatchQueue::finishTasks()
+{
+  checkCaller("finishTasks");
+  if (!tasks_.empty()) {
+    if (threads_.empty()) {
+      for (Task &task : tasks_)
+        task(0);
+    }
+    else
+      runBatches();
+    tasks_.clear();
+  }
+  if (!threads_.empty()) {
+    for (int i = 0; i < spin_count && !pending_task_count_latch_.tryWait(); i++)
+      spinPause();
+    pending_task_count_latch_.wait();
+  }
+}
+
+void
+DispatchQueue::parallelFor(size_t count,
+                           size_t grain,
+                           const RangeTask &task)
+{
+  checkCaller("parallelFor");
+  if (count == 0)
+    return;
+  size_t thread_count = threads_.size();
+  if (thread_count == 0)
+    task(0, 0, count);
+  else {
+    if (grain == 0)
+      grain = std::max(count / (thread_count * ranges_per_thread),
+                       static_cast<size_t>(1));
+    range_task_ = &task;
+    range_count_ = count;
+    range_grain_ = grain;
+    runBatches();
+    range_task_ = nullptr;
+  }
+}
+
+// Start the worker threads on tasks_ or range_task_ and wait for
+// all of them to finish so none of them is still claiming indices
+// when the next batch starts.
+void
+DispatchQueue::runBatches()
+{
+  next_index_.store(0, std::memory_order_relaxed);
+  active_threads_latch_.countUp(threads_.size());
+  generation_.fetch_add(1, std::memory_order_release);
+  wakeWorkers();
+  for (int i = 0; i < spin_count && !active_threads_latch_.tryWait(); i++)
+    spinPause();
+  active_threads_latch_.wait();
+}
+
+void
+DispatchQueue::workerLoop(size_t thread,
+                          uint64_t generation)
+{
+  worker_queue = this;
+  worker_thread = thread;
+  if (cpu_affinity_)
+    bindThreadProcessor(thread);
+  Profiler::setThreadName("worker " + std::to_string(thread));
+  // Start of the wait for the next batch or task when the profiler
+  // is enabled.
+  double idle_begin = -1.0;
+  while (true) {
+    // Read before looking for work so work queued after the look
+    // changes it and the wait below returns.
+    uint64_t wake = wake_.load(std::memory_order_acquire);
+    if (quit_.load(std::memory_order_acquire))
+      break;
+    uint64_t next_generation = generation_.load(std::memory_order_acquire);
+    bool batch = next_generation != generation;
+    generation = next_generation;
+    double busy_begin = Profiler::enabled() ? Profiler::now() : 0.0;
+    bool busy = true;
+    if (batch)
+      runBatch(thread);
+    else
+      busy = runDispatched(thread, generation);
+    if (busy) {
+      if (Profiler::enabled()) {
+        double busy_end = Profiler::now();
+        double idle = (idle_begin >= 0.0)
+          ? std::max(busy_begin - idle_begin, 0.0)
+          : 0.0;
+        Profiler::recordEvent(batch ? "dispatch batch" : "dispatch tasks",
+                              busy_begin, busy_end, nullptr, 0);
+        Profiler::recordThreadTime(thread, busy_end - busy_begin, idle);
+        idle_begin = busy_end;
+      }
+      else
+        idle_begin = -1.0;
+      if (batch)
+        active_threads_latch_.countDown();
+    }
+    else {
+      for (int i = 0;
+           i < spin_count && wake_.load(std::memory_order_acquire) == wake;
+           i++)
+        spinPause();
+      while (wake_.load(std::memory_order_acquire) == wake)
+        wake_.wait(wake, std::memory_order_acquire);
+    }
+  }
+}
 
-      lock.unlock();
+// Run dispatched tasks until there are none or a batch starts.
+bool
+DispatchQueue::runDispatched(size_t thread,
+                             uint64_t generation)
+{
+  bool ran = false;
+  Task task;
+  while (popTask(thread, task) || stealTask(thread, task)) {
+    task(thread);
+    task = nullptr;
+    pending_task_count_latch_.countDown();
+    ran = true;
+    // The caller waits for every worker to join a batch.
+    if (generation_.load(std::memory_order_acquire) != generation)
+      break;
+  }
+  return ran;
+}
 
-      op(i);
+// Run the newest task of this worker.
+bool
+DispatchQueue::popTask(size_t thread,
+                       // Return value.
+                       Task &task)
+{
+  TaskDeque *deque = deques_[thread].get();
+  std::lock_guard<std::mutex> lock(deque->lock);
+  if (deque->tasks.empty())
+    return false;
+  task = std::move(deque->tasks.back());
+  deque->tasks.pop_back();
+  return true;
+}
 
-      pending_task_count_latch_.countDown();
-      lock.lock();
+// Steal the oldest task of another worker.
+bool
+DispatchQueue::stealTask(size_t thread,
+                         // Return value.
+                         Task &task)
+{
+  size_t thread_count = deques_.size();
+  for (size_t i = 1; i < thread_count; i++) {
+    TaskDeque *deque = deques_[(thread + i) % thread_count].get();
+    std::lock_guard<std::mutex> lock(deque->lock);
+    if (!deque->tasks.empty()) {
+      task = std::move(deque->tasks.front());
+      deque->tasks.pop_front();
+      return true;
     }
-  } while (!quit_);
+  }
+  return false;
+}
+
+void
+DispatchQueue::runBatch(size_t thread)
+{
+  if (range_task_) {
+    size_t from;
+    while ((from = next_index_.fetch_add(range_grain_, std::memory_order_relaxed))
+           < range_count_) {
+      size_t to = std::min(from + range_grain_, range_count_);
+      (*range_task_)(thread, from, to);
+    }
+  }
+  else {
+    size_t task_count = tasks_.size();
+    size_t index;
+    while ((index = next_index_.fetch_add(1, std::memory_order_relaxed))
+           < task_count)
+      tasks_[index](thread);
+  }
 }
 
 } // namespace sta
@@ -44,6 +44,12 @@ processorCount()
   return std::thread::hardware_concurrency();
 }
 
+// Thread affinity is not supported.
+void
+bindThreadProcessor(size_t)
+{
+}
+
 void
 initElapsedTime()
 {
@@ -26,6 +26,8 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <pthread.h>
+#include <sched.h>
 #include <sys/resource.h>
 #include <sys/time.h>
 #include <thread>
@@ -45,6 +47,18 @@ processorCount()
   return std::thread::hardware_concurrency();
 }
 
+void
+bindThreadProcessor(size_t processor)
+{
+  int processor_count = processorCount();
+  if (processor_count > 0) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(processor % processor_count, &cpu_set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  }
+}
+
 void
 initElapsedTime()
 {
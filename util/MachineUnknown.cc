@@ -32,6 +32,11 @@ processorCount()
   return 1;
 }
 
+void
+bindThreadProcessor(size_t)
+{
+}
+
 void
 initElapsedTime()
 {
@@ -81,6 +81,12 @@ processorCount()
   return 1;
 }
 
+// Thread affinity is not supported.
+void
+bindThreadProcessor(size_t)
+{
+}
+
 void
 initElapsedTime()
 {
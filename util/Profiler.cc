@@ -0,0 +1,192 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#include "Profiler.hh"
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+#include "Error.hh"
+#include "Format.hh"
+
+namespace sta {
+
+struct ProfileEvent
+{
+  const char *name;
+  const char *arg_name;
+  int64_t arg;
+  double begin;
+  double end;
+  int thread_id;
+};
+
+struct ProfileLockWait
+{
+  size_t count;
+  double wait;
+};
+
+struct ProfileThreadTime
+{
+  double busy;
+  double idle;
+};
+
+std::atomic<bool> Profiler::enabled_{false};
+
+static std::mutex profile_lock;
+static std::chrono::steady_clock::time_point profile_epoch;
+static std::vector<ProfileEvent> profile_events;
+static std::map<int, std::string> profile_thread_names;
+static std::map<std::string, ProfileLockWait> profile_lock_waits;
+static std::vector<ProfileThreadTime> profile_thread_times;
+static std::atomic<int> profile_thread_count{0};
+static thread_local int profile_thread_id = -1;
+
+static int
+profileThreadId()
+{
+  if (profile_thread_id < 0)
+    profile_thread_id = profile_thread_count.fetch_add(1);
+  return profile_thread_id;
+}
+
+void
+Profiler::setEnabled(bool enabled)
+{
+  if (enabled) {
+    std::scoped_lock lock(profile_lock);
+    profile_epoch = std::chrono::steady_clock::now();
+    profile_events.clear();
+    profile_lock_waits.clear();
+    profile_thread_times.clear();
+  }
+  enabled_.store(enabled, std::memory_order_relaxed);
+  if (enabled)
+    setThreadName("main");
+}
+
+double
+Profiler::now()
+{
+  std::chrono::duration<double, std::micro> time =
+    std::chrono::steady_clock::now() - profile_epoch;
+  return time.count();
+}
+
+void
+Profiler::setThreadName(std::string_view name)
+{
+  int thread_id = profileThreadId();
+  std::scoped_lock lock(profile_lock);
+  profile_thread_names[thread_id] = name;
+}
+
+void
+Profiler::recordEvent(const char *name,
+                      double begin,
+                      double end,
+                      const char *arg_name,
+                      int64_t arg)
+{
+  int thread_id = profileThreadId();
+  std::scoped_lock lock(profile_lock);
+  profile_events.push_back({name, arg_name, arg, begin, end, thread_id});
+}
+
+void
+Profiler::recordThreadTime(size_t thread,
+                           double busy,
+                           double idle)
+{
+  std::scoped_lock lock(profile_lock);
+  if (thread >= profile_thread_times.size())
+    profile_thread_times.resize(thread + 1, {0.0, 0.0});
+  ProfileThreadTime &time = profile_thread_times[thread];
+  time.busy += busy;
+  time.idle += idle;
+}
+
+void
+Profiler::recordLockWait(const char *name,
+                         double wait)
+{
+  std::scoped_lock lock(profile_lock);
+  ProfileLockWait &lock_wait = profile_lock_waits[name];
+  lock_wait.count++;
+  lock_wait.wait += wait;
+}
+
+// Chrome trace event format.
+//  complete events ("ph": "X") for scopes
+//  metadata events ("ph": "M") for thread names
+//  counter events ("ph": "C") for worker busy/idle and lock waits
+void
+Profiler::writeTrace(std::string_view filename)
+{
+  FILE *stream = fopen(std::string(filename).c_str(), "w");
+  if (stream == nullptr)
+    throw FileNotWritable(filename);
+  std::scoped_lock lock(profile_lock);
+  double end = now();
+  sta::print(stream, "{{\"traceEvents\": [\n");
+  for (const auto &[thread_id, name] : profile_thread_names)
+    sta::print(stream, "{{\"name\": \"thread_name\", \"ph\": \"M\", "
+               "\"pid\": 1, \"tid\": {}, \"args\": {{\"name\": \"{}\"}}}},\n",
+               thread_id, name);
+  for (const ProfileEvent &event : profile_events) {
+    sta::print(stream, "{{\"name\": \"{}\", \"cat\": \"sta\", \"ph\": \"X\", "
+               "\"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": 1, \"tid\": {}",
+               event.name, event.begin, event.end - event.begin,
+               event.thread_id);
+    if (event.arg_name)
+      sta::print(stream, ", \"args\": {{\"{}\": {}}}",
+                 event.arg_name, event.arg);
+    sta::print(stream, "}},\n");
+  }
+  for (size_t thread = 0; thread < profile_thread_times.size(); thread++) {
+    const ProfileThreadTime &time = profile_thread_times[thread];
+    sta::print(stream, "{{\"name\": \"worker {} time us\", \"ph\": \"C\", "
+               "\"ts\": {:.3f}, \"pid\": 1, \"tid\": 0, "
+               "\"args\": {{\"busy\": {:.3f}, \"idle\": {:.3f}}}}},\n",
+               thread, end, time.busy, time.idle);
+  }
+  for (const auto &[name, lock_wait] : profile_lock_waits)
+    sta::print(stream, "{{\"name\": \"{} lock wait\", \"ph\": \"C\", "
+               "\"ts\": {:.3f}, \"pid\": 1, \"tid\": 0, "
+               "\"args\": {{\"waits\": {}, \"wait us\": {:.3f}}}}},\n",
+               name, end, lock_wait.count, lock_wait.wait);
+  // Trace viewers do not accept a trailing comma.
+  sta::print(stream, "{{\"name\": \"process_name\", \"ph\": \"M\", "
+             "\"pid\": 1, \"tid\": 0, \"args\": {{\"name\": \"sta\"}}}}\n");
+  sta::print(stream, "]}}\n");
+  if (fclose(stream) != 0)
+    throw FileNotWritable(filename);
+}
+
+} // namespace sta
@@ -27,6 +27,7 @@
 #include <algorithm>  // min
 #include <cstdlib>    // exit
 #include <cstring>    // strlen
+#include <utility>    // move
 
 #include "Error.hh"
 #include "Format.hh"
@@ -35,6 +36,7 @@
 namespace sta {
 
 Report *Report::default_ = nullptr;
+thread_local std::string *Report::thread_buffer_ = nullptr;
 
 Report::Report()
 {
@@ -53,6 +55,11 @@ void
 Report::printLine(const char *line,
                   size_t length)
 {
+  if (thread_buffer_) {
+    thread_buffer_->append(line, length);
+    thread_buffer_->push_back('\n');
+    return;
+  }
   printString(line, length);
   printString("\n", 1);
 }
@@ -61,7 +68,13 @@ size_t
 Report::printString(const char *buffer,
                     size_t length)
 {
+  if (thread_buffer_) {
+    thread_buffer_->append(buffer, length);
+    return length;
+  }
   size_t ret = length;
+  if (capture_)
+    capture_string_.append(buffer, length);
   if (redirect_to_string_)
     redirectStringPrint(buffer, length);
   else {
@@ -172,6 +185,49 @@ Report::redirectStringEnd()
   return redirect_string_.c_str();
 }
 
+void
+Report::captureBegin()
+{
+  capture_ = true;
+  capture_string_.clear();
+}
+
+std::string
+Report::captureEnd()
+{
+  capture_ = false;
+  return std::move(capture_string_);
+}
+
+void
+Report::threadBufferBegin(std::string *buffer)
+{
+  thread_buffer_ = buffer;
+}
+
+void
+Report::threadBufferEnd()
+{
+  thread_buffer_ = nullptr;
+}
+
+// Print each line with printLine so subclasses see the same calls as
+// a serial report.
+void
+Report::printThreadBuffer(const std::string &buffer)
+{
+  size_t line_begin = 0;
+  while (line_begin < buffer.size()) {
+    size_t line_end = buffer.find('\n', line_begin);
+    if (line_end == std::string::npos) {
+      printString(buffer.data() + line_begin, buffer.size() - line_begin);
+      break;
+    }
+    printLine(buffer.data() + line_begin, line_end - line_begin);
+    line_begin = line_end + 1;
+  }
+}
+
 void
 Report::redirectStringPrint(const char *buffer,
                             size_t length)
@@ -28,6 +28,7 @@
 
 #include "Error.hh"
 #include "Fuzzy.hh"
+#include "Profiler.hh"
 #include "Report.hh"
 #include "Sta.hh"
 #include "StaConfig.hh"  // STA_VERSION
@@ -101,6 +102,24 @@ set_thread_count(int count)
   Sta::sta()->setThreadCount(count);
 }
 
+void
+set_profile_enabled(bool enabled)
+{
+  Profiler::setEnabled(enabled);
+}
+
+bool
+profile_enabled()
+{
+  return Profiler::enabled();
+}
+
+void
+write_profile_cmd(std::string filename)
+{
+  Profiler::writeTrace(filename);
+}
+
 ////////////////////////////////////////////////////////////////
 
 void